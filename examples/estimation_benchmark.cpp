@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "alice_lri/Core.hpp"
+
+// Times repeated estimations of the same cloud and prints the resulting horizontal parameters, so that builds with
+// different build options can be compared on both speed and output.
+int main(int argc, char **argv) {
+    const std::string path = argc > 1 ? argv[1] : "resources/kitti_frame.bin";
+    const int32_t repetitions = argc > 2 ? std::stoi(argv[2]) : 3;
+
+    const alice_lri::Result<alice_lri::PointCloud::Double> points = alice_lri::readPointCloudFileDouble(path.c_str());
+    if (!points) {
+        std::cerr << points.status().message.c_str();
+        return 1;
+    }
+    const alice_lri::PointCloud::Double &cloud = *points;
+
+    std::vector<double> seconds;
+    alice_lri::Intrinsics intrinsics(0);
+
+    for (int32_t i = 0; i < repetitions; ++i) {
+        const auto start = std::chrono::high_resolution_clock::now();
+        const alice_lri::Result<alice_lri::Intrinsics> result = alice_lri::estimateIntrinsics(cloud);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (!result) {
+            std::cerr << result.status().message.c_str() << std::endl;
+            return 1;
+        }
+
+        const std::chrono::duration<double> duration = end - start;
+        seconds.emplace_back(duration.count());
+        intrinsics = *result;
+    }
+
+    std::cout << "scanline\tresolution\thorizontalOffset\tazimuthalOffset" << std::endl;
+    for (size_t i = 0; i < intrinsics.scanlines.size(); ++i) {
+        const alice_lri::Scanline &scanline = intrinsics.scanlines[i];
+        std::cout << i << "\t" << scanline.resolution << "\t" << scanline.horizontalOffset << "\t"
+            << scanline.azimuthalOffset << std::endl;
+    }
+
+    std::cout << "Points: " << cloud.x.size() << ", runs: " << repetitions << ", best: "
+        << *std::ranges::min_element(seconds) << " s" << std::endl;
+
+    return 0;
+}
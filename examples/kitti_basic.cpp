@@ -2,11 +2,15 @@
 #include <iostream>
 #include <optional>
 #include "alice_lri/Core.hpp"
-#include "utils/FileUtils.h"
 
 int main(int argc, char **argv) {
-    FileUtils::Points points = FileUtils::loadBinaryFile("resources/kitti_frame.bin");
-    const alice_lri::PointCloud::Double cloud(std::move(points.x), std::move(points.y), std::move(points.z));
+    const alice_lri::Result<alice_lri::PointCloud::Double> points =
+            alice_lri::readPointCloudFileDouble("resources/kitti_frame.bin");
+    if (!points) {
+        std::cerr << points.status().message.c_str();
+        return 1;
+    }
+    const alice_lri::PointCloud::Double &cloud = *points;
     const alice_lri::Result<alice_lri::Intrinsics> intrinsics = alice_lri::estimateIntrinsics(cloud);
 
     if (!intrinsics) {
@@ -2,7 +2,6 @@
 #include <iostream>
 #include <optional>
 #include "alice_lri/Core.hpp"
-#include "utils/FileUtils.h"
 
 int main(int argc, char **argv) {
     std::optional<std::string> outputPath = std::nullopt;
@@ -11,11 +10,15 @@ int main(int argc, char **argv) {
     alice_lri::AliceArray<double> arr = {1.0, 2.0, 3.0};
     std::cout << "Array size: " << arr.size() << ", capacity: " << arr.capacity() << std::endl;
 
-    FileUtils::Points points = FileUtils::loadBinaryFile(path);
+    const alice_lri::Result<alice_lri::PointCloud::Double> points = alice_lri::readPointCloudFileDouble(path.c_str());
+    if (!points) {
+        std::cerr << points.status().message.c_str();
+        return 1;
+    }
 
     auto start = std::chrono::high_resolution_clock::now();
 
-    const alice_lri::PointCloud::Double cloud{std::move(points.x), std::move(points.y), std::move(points.z)};
+    const alice_lri::PointCloud::Double &cloud = *points;
     const alice_lri::Result<alice_lri::Intrinsics> intrinsics = alice_lri::estimateIntrinsics(cloud);
 
     if (!intrinsics) {
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+#include "alice_lri/Core.hpp"
+
+struct BenchmarkRun {
+    alice_lri::IntrinsicsDetailed intrinsics;
+    double seconds;
+};
+
+std::optional<BenchmarkRun> runEstimation(const alice_lri::PointCloud::Double &cloud, const uint64_t subsampleSize) {
+    const alice_lri::EstimationOptions options{.subsampleSize = subsampleSize};
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    const alice_lri::Result<alice_lri::IntrinsicsDetailed> intrinsics = alice_lri::estimateIntrinsicsDetailed(
+        cloud, options
+    );
+    const auto end = std::chrono::high_resolution_clock::now();
+
+    if (!intrinsics) {
+        std::cerr << intrinsics.status().message.c_str() << std::endl;
+        return std::nullopt;
+    }
+
+    const std::chrono::duration<double> duration = end - start;
+    return BenchmarkRun{*intrinsics, duration.count()};
+}
+
+void printComparison(const uint64_t subsampleSize, const BenchmarkRun &reference, const BenchmarkRun &run) {
+    const auto &referenceScanlines = reference.intrinsics.scanlines;
+    const auto &scanlines = run.intrinsics.scanlines;
+
+    double maxAngleError = 0, maxOffsetError = 0;
+    int32_t resolutionMismatches = 0;
+    int64_t pointsCountError = 0;
+
+    const bool sameScanlines = referenceScanlines.size() == scanlines.size();
+    if (sameScanlines) {
+        for (size_t i = 0; i < scanlines.size(); ++i) {
+            const auto &expected = referenceScanlines[i];
+            const auto &actual = scanlines[i];
+
+            maxAngleError = std::max(maxAngleError, std::abs(expected.verticalAngle.value - actual.verticalAngle.value));
+            maxOffsetError = std::max(maxOffsetError, std::abs(expected.verticalOffset.value - actual.verticalOffset.value));
+            resolutionMismatches += expected.resolution != actual.resolution;
+            pointsCountError += std::abs(
+                static_cast<int64_t>(expected.pointsCount) - static_cast<int64_t>(actual.pointsCount)
+            );
+        }
+    }
+
+    std::cout << subsampleSize << "\t" << run.seconds << "\t" << reference.seconds / run.seconds << "\t"
+        << scanlines.size() << "\t";
+
+    if (sameScanlines) {
+        std::cout << maxAngleError << "\t" << maxOffsetError << "\t" << resolutionMismatches << "\t"
+            << pointsCountError << "\t";
+    } else {
+        std::cout << "-\t-\t-\t-\t";
+    }
+
+    std::cout << run.intrinsics.unassignedPoints << std::endl;
+}
+
+int main(int argc, char **argv) {
+    const std::string path = argc > 1 ? argv[1] : "resources/kitti_frame.bin";
+    std::vector<uint64_t> subsampleSizes = {8000, 16000, 32000, 64000};
+
+    if (argc > 2) {
+        subsampleSizes.clear();
+        for (int i = 2; i < argc; ++i) {
+            subsampleSizes.emplace_back(std::stoull(argv[i]));
+        }
+    }
+
+    const alice_lri::Result<alice_lri::PointCloud::Double> points = alice_lri::readPointCloudFileDouble(path.c_str());
+    if (!points) {
+        std::cerr << points.status().message.c_str();
+        return 1;
+    }
+    const alice_lri::PointCloud::Double &cloud = *points;
+
+    const auto reference = runEstimation(cloud, 0);
+    if (!reference) {
+        return 1;
+    }
+
+    std::cout << "Points: " << cloud.x.size() << ", full estimation: " << reference->seconds << " s, "
+        << reference->intrinsics.scanlines.size() << " scanlines" << std::endl;
+    std::cout << "subsample\tseconds\tspeedup\tscanlines\tmaxAngleErr\tmaxOffsetErr\tresolutionMismatches\t"
+        << "pointsCountErr\tunassigned" << std::endl;
+
+    for (const uint64_t subsampleSize : subsampleSizes) {
+        const auto run = runEstimation(cloud, subsampleSize);
+        if (!run) {
+            return 1;
+        }
+
+        printComparison(subsampleSize, *reference, *run);
+    }
+
+    return 0;
+}
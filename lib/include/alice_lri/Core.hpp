@@ -6,6 +6,8 @@
 #include "util/AliceString.hpp"
 #include "alice_lri/Structs.hpp"
 #include "alice_lri/Result.hpp"
+#include "alice_lri/PreparedCloud.hpp"
+#include "alice_lri/PointCloudReader.hpp"
 
 namespace alice_lri {
 
@@ -37,6 +39,126 @@ namespace alice_lri {
      */
     ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(const PointCloud::Double &points) noexcept;
 
+    /**
+     * @brief Estimate sensor intrinsics from a float point cloud with custom options.
+     * @param points Input point cloud (float precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::Float &points, const EstimationOptions &options
+    ) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from a double point cloud with custom options.
+     * @param points Input point cloud (double precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::Double &points, const EstimationOptions &options
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from a float point cloud with custom options.
+     * @param points Input point cloud (float precision).
+     * @param options Estimation options. When subsampling, point counts refer to the full point cloud.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::Float &points, const EstimationOptions &options
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from a double point cloud with custom options.
+     * @param points Input point cloud (double precision).
+     * @param options Estimation options. When subsampling, point counts refer to the full point cloud.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::Double &points, const EstimationOptions &options
+    ) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from a float point cloud view, without copying it.
+     * @param points Input point cloud view (non-owning, float precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::FloatView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from a double point cloud view, without copying it.
+     * @param points Input point cloud view (non-owning, double precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::DoubleView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from a float point cloud view, without copying it.
+     * @param points Input point cloud view (non-owning, float precision).
+     * @param options Estimation options.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::FloatView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from a double point cloud view, without copying it.
+     * @param points Input point cloud view (non-owning, double precision).
+     * @param options Estimation options.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::DoubleView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from interleaved float point records, without de-interleaving them.
+     * @param points Input strided point cloud view (non-owning, float precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::FloatStridedView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from interleaved double point records, without de-interleaving them.
+     * @param points Input strided point cloud view (non-owning, double precision).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::DoubleStridedView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from interleaved float point records, without de-interleaving them.
+     * @param points Input strided point cloud view (non-owning, float precision).
+     * @param options Estimation options.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::FloatStridedView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from interleaved double point records, without de-interleaving them.
+     * @param points Input strided point cloud view (non-owning, double precision).
+     * @param options Estimation options.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::DoubleStridedView &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
     /**
      * @brief Project a point cloud to a range image using given intrinsics (float).
      * @param intrinsics Sensor intrinsics.
@@ -53,6 +175,227 @@ namespace alice_lri {
      */
     ALICE_LRI_API Result<RangeImage> projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Double &points) noexcept;
 
+    /**
+     * @brief Project a point cloud view to a range image using given intrinsics (float), without copying it.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud view (non-owning, float precision).
+     * @return Result containing RangeImage or error status.
+     */
+    ALICE_LRI_API Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatView &points
+    ) noexcept;
+
+    /**
+     * @brief Project a point cloud view to a range image using given intrinsics (double), without copying it.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud view (non-owning, double precision).
+     * @return Result containing RangeImage or error status.
+     */
+    ALICE_LRI_API Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleView &points
+    ) noexcept;
+
+    /**
+     * @brief Project interleaved float point records to a range image using given intrinsics, without de-interleaving them.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input strided point cloud view (non-owning, float precision).
+     * @return Result containing RangeImage or error status.
+     */
+    ALICE_LRI_API Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatStridedView &points
+    ) noexcept;
+
+    /**
+     * @brief Project interleaved double point records to a range image using given intrinsics, without de-interleaving them.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input strided point cloud view (non-owning, double precision).
+     * @return Result containing RangeImage or error status.
+     */
+    ALICE_LRI_API Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleStridedView &points
+    ) noexcept;
+
+    /**
+     * @brief Validate a float point cloud and compute its per-point data once, for later estimation and projection.
+     * @param points Input float point cloud.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::Float &points) noexcept;
+
+    /**
+     * @brief Validate a double point cloud and compute its per-point data once, for later estimation and projection.
+     * @param points Input double point cloud.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::Double &points) noexcept;
+
+    /**
+     * @brief Validate a float point cloud view and compute its per-point data once, for later estimation and projection.
+     * @param points Input float point cloud view.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::FloatView &points) noexcept;
+
+    /**
+     * @brief Validate a double point cloud view and compute its per-point data once, for later estimation and projection.
+     * @param points Input double point cloud view.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::DoubleView &points) noexcept;
+
+    /**
+     * @brief Validate a strided float point cloud view and compute its per-point data once, for later estimation and projection.
+     * @param points Input strided float point cloud view.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::FloatStridedView &points) noexcept;
+
+    /**
+     * @brief Validate a strided double point cloud view and compute its per-point data once, for later estimation and projection.
+     * @param points Input strided double point cloud view.
+     * @return Result containing the PreparedCloud or error status.
+     */
+    ALICE_LRI_API Result<PreparedCloud> prepareCloud(const PointCloud::DoubleStridedView &points) noexcept;
+
+    /**
+     * @brief Estimate sensor intrinsics from a prepared point cloud, skipping validation and per-point setup.
+     * @param points Prepared point cloud (see prepareCloud).
+     * @param options Estimation options.
+     * @return Result containing estimated Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<Intrinsics> estimateIntrinsics(
+        const PreparedCloud &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Estimate detailed sensor intrinsics from a prepared point cloud, skipping validation and per-point setup.
+     * @param points Prepared point cloud (see prepareCloud).
+     * @param options Estimation options.
+     * @return Result containing detailed Intrinsics or error status.
+     */
+    ALICE_LRI_API Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PreparedCloud &points, const EstimationOptions &options = EstimationOptions()
+    ) noexcept;
+
+    /**
+     * @brief Project a prepared point cloud to a range image, reusing its ranges and angles.
+     *
+     * The prepared cloud holds double coordinates, so the image matches the projection of a double point cloud.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Prepared point cloud (see prepareCloud).
+     * @return Result containing RangeImage or error status.
+     */
+    ALICE_LRI_API Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PreparedCloud &points
+    ) noexcept;
+
+    /**
+     * @brief Project a point cloud to a ragged range image using given intrinsics (float).
+     *
+     * Each row is as wide as the horizontal resolution of its scanline, instead of the least common multiple of all
+     * of them. Rows of scanlines without a known resolution are as wide as the finest scanline.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud (float precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Float &points
+    ) noexcept;
+
+    /**
+     * @brief Project a point cloud to a ragged range image using given intrinsics (double).
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud (double precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Double &points
+    ) noexcept;
+
+    /**
+     * @brief Project a point cloud view to a ragged range image using given intrinsics (float), without copying it.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud view (non-owning, float precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatView &points
+    ) noexcept;
+
+    /**
+     * @brief Project a point cloud view to a ragged range image using given intrinsics (double), without copying it.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud view (non-owning, double precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleView &points
+    ) noexcept;
+
+    /**
+     * @brief Project interleaved float point records to a ragged range image, without de-interleaving them.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input strided point cloud view (non-owning, float precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatStridedView &points
+    ) noexcept;
+
+    /**
+     * @brief Project interleaved double point records to a ragged range image, without de-interleaving them.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input strided point cloud view (non-owning, double precision).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleStridedView &points
+    ) noexcept;
+
+    /**
+     * @brief Project a prepared point cloud to a ragged range image, reusing its ranges and angles.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Prepared point cloud (see prepareCloud).
+     * @return Result containing RaggedRangeImage or error status.
+     */
+    ALICE_LRI_API Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PreparedCloud &points
+    ) noexcept;
+
+    /**
+     * @brief Project a float point cloud to a quantized range image using given intrinsics.
+     *
+     * The ranges are stored as fixed-point codes whose step is the coordinate quantization measured on the points,
+     * so that each stored range is within the rounding the sensor already applies to each coordinate. Every stored
+     * range is checked against the projected one, and the pixels are 16-bit when the codes fit.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud (float precision).
+     * @return Result containing QuantizedRangeImage or error status, QUANTIZATION_ERROR if a range does not round trip.
+     */
+    ALICE_LRI_API Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Float &points
+    ) noexcept;
+
+    /**
+     * @brief Project a double point cloud to a quantized range image using given intrinsics.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Input point cloud (double precision).
+     * @return Result containing QuantizedRangeImage or error status, QUANTIZATION_ERROR if a range does not round trip.
+     */
+    ALICE_LRI_API Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Double &points
+    ) noexcept;
+
+    /**
+     * @brief Project a prepared point cloud to a quantized range image, reusing its data and coordinate quantization.
+     * @param intrinsics Sensor intrinsics.
+     * @param points Prepared point cloud (see prepareCloud).
+     * @return Result containing QuantizedRangeImage or error status, QUANTIZATION_ERROR if a range does not round trip.
+     */
+    ALICE_LRI_API Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PreparedCloud &points
+    ) noexcept;
+
     /**
      * @brief Unproject a range image to a double point cloud using given intrinsics.
      * @param intrinsics Sensor intrinsics.
@@ -61,6 +404,26 @@ namespace alice_lri {
      */
     ALICE_LRI_API PointCloud::Double unProjectToPointCloud(const Intrinsics &intrinsics, const RangeImage &rangeImage) noexcept;
 
+    /**
+     * @brief Unproject a ragged range image to a double point cloud using given intrinsics.
+     * @param intrinsics Sensor intrinsics.
+     * @param rangeImage Input ragged range image.
+     * @return Unprojected point cloud (double precision).
+     */
+    ALICE_LRI_API PointCloud::Double unProjectToPointCloud(
+        const Intrinsics &intrinsics, const RaggedRangeImage &rangeImage
+    ) noexcept;
+
+    /**
+     * @brief Unproject a quantized range image to a double point cloud using given intrinsics.
+     * @param intrinsics Sensor intrinsics.
+     * @param rangeImage Input quantized range image.
+     * @return Unprojected point cloud (double precision).
+     */
+    ALICE_LRI_API PointCloud::Double unProjectToPointCloud(
+        const Intrinsics &intrinsics, const QuantizedRangeImage &rangeImage
+    ) noexcept;
+
     /**
      * @brief Parse Intrinsics from a JSON string.
      * @param json JSON string.
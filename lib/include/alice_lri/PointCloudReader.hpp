@@ -0,0 +1,105 @@
+/**
+ * @file PointCloudReader.hpp
+ * @brief Memory mapped readers for binary point cloud files.
+ */
+#pragma once
+#include <cstdint>
+
+#include "alice_lri/ApiGuards.hpp"
+#include "alice_lri/Structs.hpp"
+#include "alice_lri/Result.hpp"
+
+namespace alice_lri {
+
+    /**
+     * @brief Binary point cloud file formats supported by the readers.
+     *
+     * Coordinates must be stored as little endian float32 values. Other fields, such as intensity or ring, may have
+     * any scalar type and are skipped.
+     */
+    enum class PointFileFormat {
+        AUTO,      /**< Detected from the file extension: .bin, .pcd or .ply. */
+        KITTI_BIN, /**< KITTI Velodyne scan: headerless x, y, z and intensity float32 records. */
+        PCD,       /**< Point Cloud Library file with binary (uncompressed) data. */
+        PLY,       /**< Binary little endian PLY file whose first element is the vertex list. */
+    };
+
+    /**
+     * @brief Point cloud file mapped into memory, whose records are read in place.
+     *
+     * The view points into the mapping, so it is only valid while this object is alive. Records whose coordinates
+     * are not aligned to whole floats, as happens with some PCD and PLY headers, are copied once into an aligned
+     * buffer instead. All points are kept, including the all-zero ones that some sensors emit for missing returns.
+     */
+    class ALICE_LRI_API MappedPointCloud {
+    private:
+        struct Impl; /**< Implementation details (opaque pointer to the mapping). */
+        Impl* impl = nullptr;
+
+        explicit MappedPointCloud(Impl* impl) noexcept;
+        friend class MappedPointCloudAccess;
+
+    public:
+        /**
+         * @brief Move constructor. Transfers ownership.
+         * @param other Mapped point cloud to move from.
+         */
+        MappedPointCloud(MappedPointCloud&& other) noexcept;
+
+        /**
+         * @brief Move assignment. Transfers ownership.
+         * @param other Mapped point cloud to move from.
+         * @return Reference to this mapped point cloud.
+         */
+        MappedPointCloud& operator=(MappedPointCloud&& other) noexcept;
+
+        MappedPointCloud(const MappedPointCloud&) = delete;
+        MappedPointCloud& operator=(const MappedPointCloud&) = delete;
+
+        /** Destructor. Unmaps the file. */
+        ~MappedPointCloud();
+
+        /** @return Number of point records, zero for a moved-from object. */
+        [[nodiscard]] uint64_t size() const noexcept;
+
+        /** @return Strided view over the point records, empty for a moved-from object. */
+        [[nodiscard]] PointCloud::FloatStridedView view() const noexcept;
+    };
+
+    /**
+     * @brief Map a binary point cloud file into memory without copying its records.
+     * @param path Path to the file.
+     * @param format File format, detected from the extension by default.
+     * @return Result containing the MappedPointCloud or error status.
+     */
+    ALICE_LRI_API Result<MappedPointCloud> mapPointCloudFile(
+        const char* path, PointFileFormat format = PointFileFormat::AUTO
+    ) noexcept;
+
+    /**
+     * @brief Read a binary point cloud file into a float point cloud, skipping all-zero points.
+     *
+     * The file is mapped and its coordinates are copied once into the result.
+     *
+     * @param path Path to the file.
+     * @param format File format, detected from the extension by default.
+     * @return Result containing the point cloud or error status.
+     */
+    ALICE_LRI_API Result<PointCloud::Float> readPointCloudFile(
+        const char* path, PointFileFormat format = PointFileFormat::AUTO
+    ) noexcept;
+
+    /**
+     * @brief Read a binary point cloud file into a double point cloud, skipping all-zero points.
+     *
+     * The float coordinates of the file are widened once, so the cloud takes the double precision estimation and
+     * projection paths.
+     *
+     * @param path Path to the file.
+     * @param format File format, detected from the extension by default.
+     * @return Result containing the point cloud or error status.
+     */
+    ALICE_LRI_API Result<PointCloud::Double> readPointCloudFileDouble(
+        const char* path, PointFileFormat format = PointFileFormat::AUTO
+    ) noexcept;
+}
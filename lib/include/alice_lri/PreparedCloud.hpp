@@ -0,0 +1,51 @@
+/**
+ * @file PreparedCloud.hpp
+ * @brief Validated point cloud handle shared between estimation and projection.
+ */
+#pragma once
+#include <cstdint>
+
+#include "alice_lri/ApiGuards.hpp"
+
+namespace alice_lri {
+
+    /**
+     * @brief Point cloud validated and converted once, together with its per-point ranges and angles.
+     *
+     * Estimation and projection both accept it, so a cloud that goes through both steps is only validated, converted
+     * to double precision and processed once. Derived fields computed by one call are kept for the following ones. It
+     * owns its data, so the source cloud may be released after preparing it. It may be reused across successive calls,
+     * but must not be passed to concurrent ones.
+     */
+    class ALICE_LRI_API PreparedCloud {
+    private:
+        struct Impl; /**< Implementation details (opaque pointer to the internal point array). */
+        Impl* impl = nullptr;
+
+        explicit PreparedCloud(Impl* impl) noexcept;
+        friend class PreparedCloudAccess;
+
+    public:
+        /**
+         * @brief Move constructor. Transfers ownership.
+         * @param other Prepared cloud to move from.
+         */
+        PreparedCloud(PreparedCloud&& other) noexcept;
+
+        /**
+         * @brief Move assignment. Transfers ownership.
+         * @param other Prepared cloud to move from.
+         * @return Reference to this prepared cloud.
+         */
+        PreparedCloud& operator=(PreparedCloud&& other) noexcept;
+
+        PreparedCloud(const PreparedCloud&) = delete;
+        PreparedCloud& operator=(const PreparedCloud&) = delete;
+
+        /** Destructor. Frees the owned data. */
+        ~PreparedCloud();
+
+        /** @return Number of points. */
+        [[nodiscard]] uint64_t size() const noexcept;
+    };
+}
@@ -19,6 +19,10 @@ namespace alice_lri {
         EMPTY_POINT_CLOUD,     /**< Point cloud is empty. */
         RANGES_XY_ZERO,        /**< At least one point has a range of zero in the XY plane. */
         INTERNAL_ERROR,        /**< Internal error occurred. */
+        INVALID_LAYOUT,        /**< Strided point records are misaligned or their coordinates exceed the stride. */
+        FILE_ERROR,            /**< Point cloud file cannot be opened or mapped. */
+        INVALID_FILE_FORMAT,   /**< Point cloud file is malformed or its format is not supported. */
+        QUANTIZATION_ERROR,    /**< Ranges cannot be stored as fixed-point codes within the round-trip error bound. */
     };
 
     /**
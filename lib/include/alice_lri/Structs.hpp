@@ -87,6 +87,178 @@ namespace alice_lri {
         double* data() noexcept { return pixels.data(); }
     };
 
+    /**
+     * @brief Range image whose rows are as wide as the horizontal resolution of their scanlines.
+     *
+     * Rows are stored back to back in row-major order, so the number of pixels is the sum of the row widths instead
+     * of the height times the least common multiple of the resolutions. Row r starts at rowOffset(r) in the pixel data.
+     */
+    struct ALICE_LRI_API RaggedRangeImage {
+    private:
+        /** Pixel values (row-major order, rows stored back to back). */
+        AliceArray<double> pixels;
+        /** Offset of each row in the pixel data, followed by the total number of pixels. */
+        AliceArray<uint64_t> offsets;
+
+    public:
+        /** Default constructor (empty image). */
+        RaggedRangeImage() noexcept : offsets(1, 0) { }
+        /**
+         * @brief Construct with the width of each row and an initial pixel value.
+         * @param rowWidths Width of each row, with h elements
+         * @param h Image height
+         * @param initialValue Initial value for all pixels
+         */
+        RaggedRangeImage(const uint32_t *rowWidths, const uint32_t h, const double initialValue) noexcept :
+            offsets(h + 1, 0) {
+            for (uint32_t row = 0; row < h; ++row) {
+                offsets[row + 1] = offsets[row] + rowWidths[row];
+            }
+            pixels = AliceArray<double>(offsets[h], initialValue);
+        }
+
+        /**
+         * @brief Access pixel at (row, col), with col below rowWidth(row).
+         */
+        double& operator()(const uint32_t row, const uint32_t col) noexcept { return pixels[offsets[row] + col]; }
+        /**
+         * @brief Access pixel at (row, col), with col below rowWidth(row) (const).
+         */
+        const double& operator()(const uint32_t row, const uint32_t col) const noexcept {
+            return pixels[offsets[row] + col];
+        }
+
+        /** @return Image height. */
+        [[nodiscard]] uint32_t height() const noexcept { return static_cast<uint32_t>(offsets.size() - 1); }
+        /** @return Width of a row. */
+        [[nodiscard]] uint32_t rowWidth(const uint32_t row) const noexcept {
+            return static_cast<uint32_t>(offsets[row + 1] - offsets[row]);
+        }
+        /** @return Offset of the first pixel of a row in the pixel data. */
+        [[nodiscard]] uint64_t rowOffset(const uint32_t row) const noexcept { return offsets[row]; }
+        /** @return Pointer to the row offsets, with height() + 1 elements ending with the total number of pixels. */
+        [[nodiscard]] const uint64_t* rowOffsets() const noexcept { return offsets.data(); }
+        /** @return Total number of pixels. */
+        [[nodiscard]] uint64_t size() const noexcept { return pixels.size(); }
+        /** @return Pointer to pixel data (const). */
+        [[nodiscard]] const double* data() const noexcept { return pixels.data(); }
+        /** @return Pointer to pixel data. */
+        double* data() noexcept { return pixels.data(); }
+    };
+
+    /**
+     * @brief Integer type of the pixels of a QuantizedRangeImage.
+     */
+    enum class QuantizedPixelType {
+        UINT16, /**< 16-bit unsigned pixels. */
+        UINT32 /**< 32-bit unsigned pixels. */
+    };
+
+    /**
+     * @brief Range image with fixed-point pixels, laid out like RangeImage.
+     *
+     * A pixel stores an integer code, with zero for empty pixels. Its range is offset() + code * scale(), within
+     * maxRangeError() of the projected range. The pixels are 16-bit when the codes fit, and 32-bit otherwise.
+     */
+    struct ALICE_LRI_API QuantizedRangeImage {
+    private:
+        /** 16-bit pixel codes (row-major order), only filled for QuantizedPixelType::UINT16. */
+        AliceArray<uint16_t> pixels16;
+        /** 32-bit pixel codes (row-major order), only filled for QuantizedPixelType::UINT32. */
+        AliceArray<uint32_t> pixels32;
+        /** Image width. */
+        uint32_t w;
+        /** Image height. */
+        uint32_t h;
+        /** Pixel type. */
+        QuantizedPixelType type;
+        /** Range step of one code. */
+        double rangeScale;
+        /** Range of code zero. */
+        double rangeOffset;
+
+    public:
+        /** Default constructor (empty image). */
+        QuantizedRangeImage() noexcept :
+            w(0), h(0), type(QuantizedPixelType::UINT16), rangeScale(1), rangeOffset(0) { }
+        /**
+         * @brief Construct with all pixels empty.
+         * @param w Image width
+         * @param h Image height
+         * @param type Pixel type
+         * @param scale Range step of one code
+         * @param offset Range of code zero
+         */
+        QuantizedRangeImage(
+            const uint32_t w, const uint32_t h, const QuantizedPixelType type, const double scale, const double offset
+        ) noexcept : w(w), h(h), type(type), rangeScale(scale), rangeOffset(offset) {
+            if (type == QuantizedPixelType::UINT16) {
+                pixels16 = AliceArray<uint16_t>(static_cast<uint64_t>(w) * h, 0);
+            } else {
+                pixels32 = AliceArray<uint32_t>(static_cast<uint64_t>(w) * h, 0);
+            }
+        }
+
+        /** @return Code of the pixel at (row, col), zero if empty. */
+        [[nodiscard]] uint32_t code(const uint32_t row, const uint32_t col) const noexcept {
+            const uint64_t idx = static_cast<uint64_t>(row) * w + col;
+            return type == QuantizedPixelType::UINT16 ? pixels16[idx] : pixels32[idx];
+        }
+        /**
+         * @brief Set the code of the pixel at (row, col). It must fit the pixel type.
+         */
+        void setCode(const uint32_t row, const uint32_t col, const uint32_t value) noexcept {
+            const uint64_t idx = static_cast<uint64_t>(row) * w + col;
+            if (type == QuantizedPixelType::UINT16) {
+                pixels16[idx] = static_cast<uint16_t>(value);
+            } else {
+                pixels32[idx] = value;
+            }
+        }
+        /** @return Range of the pixel at (row, col), zero if empty. */
+        [[nodiscard]] double range(const uint32_t row, const uint32_t col) const noexcept {
+            const uint32_t value = code(row, col);
+            return value == 0 ? 0 : rangeOffset + value * rangeScale;
+        }
+
+        /** @return Image width. */
+        [[nodiscard]] uint32_t width() const noexcept { return w; }
+        /** @return Image height. */
+        [[nodiscard]] uint32_t height() const noexcept { return h; }
+        /** @return Total number of pixels. */
+        [[nodiscard]] uint64_t size() const noexcept { return static_cast<uint64_t>(w) * h; }
+        /** @return Pixel type. */
+        [[nodiscard]] QuantizedPixelType pixelType() const noexcept { return type; }
+        /** @return Range step of one code. */
+        [[nodiscard]] double scale() const noexcept { return rangeScale; }
+        /** @return Range of code zero. */
+        [[nodiscard]] double offset() const noexcept { return rangeOffset; }
+        /** @return Largest difference between a stored range and the projected one, half a step. */
+        [[nodiscard]] double maxRangeError() const noexcept { return rangeScale / 2; }
+        /** @return Pointer to 16-bit pixel data, null unless the pixel type is UINT16. */
+        [[nodiscard]] const uint16_t* data16() const noexcept {
+            return type == QuantizedPixelType::UINT16 ? pixels16.data() : nullptr;
+        }
+        /** @return Pointer to 32-bit pixel data, null unless the pixel type is UINT32. */
+        [[nodiscard]] const uint32_t* data32() const noexcept {
+            return type == QuantizedPixelType::UINT32 ? pixels32.data() : nullptr;
+        }
+
+        /**
+         * @brief Restore the ranges into a RangeImage.
+         * @return Range image with the stored ranges, and zero for empty pixels.
+         */
+        [[nodiscard]] RangeImage toRangeImage() const noexcept {
+            RangeImage image(w, h, 0);
+            for (uint32_t row = 0; row < h; ++row) {
+                for (uint32_t col = 0; col < w; ++col) {
+                    image(row, col) = range(row, col);
+                }
+            }
+            return image;
+        }
+    };
+
     /**
      * @brief Namespace for point cloud data structures.
      */
@@ -134,6 +306,84 @@ namespace alice_lri {
                 z.reserve(count);
             }
         };
+
+        /**
+         * @brief Non-owning view of a float point cloud stored in separate coordinate buffers.
+         *
+         * The buffers are read in place and must outlive the call that receives the view.
+         */
+        struct FloatView {
+            /** X coordinates. */
+            const float *x = nullptr;
+            /** Y coordinates. */
+            const float *y = nullptr;
+            /** Z coordinates. */
+            const float *z = nullptr;
+            /** Number of points in each buffer. */
+            uint64_t size = 0;
+        };
+
+        /**
+         * @brief Non-owning view of a double point cloud stored in separate coordinate buffers.
+         *
+         * The buffers are read in place and must outlive the call that receives the view.
+         */
+        struct DoubleView {
+            /** X coordinates. */
+            const double *x = nullptr;
+            /** Y coordinates. */
+            const double *y = nullptr;
+            /** Z coordinates. */
+            const double *z = nullptr;
+            /** Number of points in each buffer. */
+            uint64_t size = 0;
+        };
+
+        /**
+         * @brief Non-owning view of interleaved float point records, such as XYZI frames stored as float[4].
+         *
+         * The coordinates of point i are read at base + i * stride + offset, all in bytes. The base address, the
+         * stride and the offsets must be multiples of sizeof(float), and each coordinate must lie within its record, i.e.
+         * offset + sizeof(float) <= stride. Extra fields such as intensity are ignored. The buffer is read in place and
+         * must outlive the call that receives the view.
+         */
+        struct FloatStridedView {
+            /** Address of the first record. */
+            const void *base = nullptr;
+            /** Number of records. */
+            uint64_t size = 0;
+            /** Distance between consecutive records, in bytes. */
+            uint64_t stride = 4 * sizeof(float);
+            /** Offset of the X coordinate within a record, in bytes. */
+            uint64_t xOffset = 0;
+            /** Offset of the Y coordinate within a record, in bytes. */
+            uint64_t yOffset = sizeof(float);
+            /** Offset of the Z coordinate within a record, in bytes. */
+            uint64_t zOffset = 2 * sizeof(float);
+        };
+
+        /**
+         * @brief Non-owning view of interleaved double point records, such as XYZI frames stored as double[4].
+         *
+         * The coordinates of point i are read at base + i * stride + offset, all in bytes. The base address, the
+         * stride and the offsets must be multiples of sizeof(double), and each coordinate must lie within its record, i.e.
+         * offset + sizeof(double) <= stride. Extra fields such as intensity are ignored. The buffer is read in place and
+         * must outlive the call that receives the view.
+         */
+        struct DoubleStridedView {
+            /** Address of the first record. */
+            const void *base = nullptr;
+            /** Number of records. */
+            uint64_t size = 0;
+            /** Distance between consecutive records, in bytes. */
+            uint64_t stride = 4 * sizeof(double);
+            /** Offset of the X coordinate within a record, in bytes. */
+            uint64_t xOffset = 0;
+            /** Offset of the Y coordinate within a record, in bytes. */
+            uint64_t yOffset = sizeof(double);
+            /** Offset of the Z coordinate within a record, in bytes. */
+            uint64_t zOffset = 2 * sizeof(double);
+        };
     }
 
     /**
@@ -266,4 +516,26 @@ namespace alice_lri {
             scanlines.resize(scanlineCount);
         }
     };
+
+    /**
+     * @brief Options controlling how intrinsics are estimated.
+     */
+    struct ALICE_LRI_API EstimationOptions {
+        /**
+         * Target number of points used for estimation. If non-zero and smaller than the point cloud, the estimation
+         * runs on a deterministic subsample stratified by vertical angle and range. Zero uses all points.
+         */
+        uint64_t subsampleSize = 0;
+
+        /**
+         * Optional per-point scanline labels, such as the ring or laser index provided by many drivers, with one
+         * non-negative label per point. Labels need not be contiguous. When set, each labelled group is fitted
+         * directly instead of searching for scanlines, which is much faster. Labels that do not describe valid
+         * scanlines fall back to the full search. The buffer is not copied and must outlive the call.
+         */
+        const int32_t *scanlineLabels = nullptr;
+
+        /** Number of scanline labels. It must match the number of points when labels are given. */
+        uint64_t scanlineLabelsCount = 0;
+    };
 }
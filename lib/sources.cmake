@@ -1,11 +1,21 @@
 set(ALICE_LRI_SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/src/includeimpl/Core.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/includeimpl/PreparedCloud.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/includeimpl/PreparedCloudAccess.h
+        ${CMAKE_CURRENT_LIST_DIR}/include/alice_lri/PreparedCloud.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/includeimpl/PointCloudReader.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/include/alice_lri/PointCloudReader.hpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/io/PointFileLayout.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/io/PointFileLayout.h
         ${CMAKE_CURRENT_LIST_DIR}/src/utils/logger/Logger.h
         ${CMAKE_CURRENT_LIST_DIR}/src/utils/Timer.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/utils/Parallel.h
         ${CMAKE_CURRENT_LIST_DIR}/src/point/PointUtils.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/point/PointUtils.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/VerticalIntrinsicsEstimator.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/VerticalIntrinsicsEstimator.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/VerticalLabelledEstimator.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/VerticalLabelledEstimator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/IntrinsicsEstimator.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/IntrinsicsEstimator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/hough/HoughTransform.cpp
@@ -14,6 +24,7 @@ set(ALICE_LRI_SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/src/hash/HashUtils.h
         ${CMAKE_CURRENT_LIST_DIR}/src/point/PointArray.h
         ${CMAKE_CURRENT_LIST_DIR}/src/point/PointArray.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/point/CoordinateMaps.h
         ${CMAKE_CURRENT_LIST_DIR}/src/utils/Utils.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/helper/VerticalLogging.h
         ${CMAKE_CURRENT_LIST_DIR}/src/utils/json/JsonConverters.cpp
@@ -33,6 +44,8 @@ set(ALICE_LRI_SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/HorizontalIntrinsicsEstimator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/rangeimage/RangeImageUtils.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/rangeimage/RangeImageUtils.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/rangeimage/ScanlineLookup.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/rangeimage/ScanlineLookup.h
         ${CMAKE_CURRENT_LIST_DIR}/src/Constants.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/SegmentedMedianLinearRegressor.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/SegmentedMedianLinearRegressor.h
@@ -43,8 +56,12 @@ set(ALICE_LRI_SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalScanlineEstimator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/PeriodicFitter.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/PeriodicFitter.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/ResolutionCandidateGenerator.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/horizontal/helper/ResolutionCandidateGenerator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/math/Trigonometry.h
         ${CMAKE_CURRENT_LIST_DIR}/src/math/Trigonometry.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/math/FastMath.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/math/FastMath.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalHeuristicsEstimator.cpp
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalHeuristicsEstimator.h
         ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalScanlineEstimationStructs.h
@@ -63,4 +80,8 @@ set(ALICE_LRI_SOURCES
         ${CMAKE_CURRENT_LIST_DIR}/include/alice_lri/util/AliceString.hpp
         ${CMAKE_CURRENT_LIST_DIR}/include/alice_lri/util/AliceArray.hpp
         ${CMAKE_CURRENT_LIST_DIR}/src/includeimpl/Result.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/point/PointSubsampler.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/point/PointSubsampler.h
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalScanlineAssigner.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/src/intrinsics/vertical/estimation/VerticalScanlineAssigner.h
 )
@@ -10,8 +10,23 @@ namespace alice_lri::Constant {
     constexpr double OFFSET_STEP = 1e-3;
     constexpr double ANGLE_STEP = 1e-4;
     constexpr uint64_t VERTICAL_MAX_FIT_ATTEMPTS = 10;
+    constexpr double VERTICAL_MAX_OFFSET_CI_WIDTH = 1e-2;
 
     constexpr int32_t MAX_RESOLUTION = 10000;
     constexpr double INV_RANGES_SEGMENT_THRESHOLD = 1e-2;
     constexpr int32_t HORIZONTAL_MIN_POINTS_PER_SCANLINE = 16;
+
+    // Expected horizontal loss if residuals were uniformly distributed within the resolution step
+    constexpr double HORIZONTAL_UNIFORM_LOSS = TWO_PI * TWO_PI / 12;
+    constexpr double HORIZONTAL_CANDIDATE_MAX_LOSS = HORIZONTAL_UNIFORM_LOSS / 4;
+    constexpr double HORIZONTAL_HINT_MAX_LOSS = HORIZONTAL_UNIFORM_LOSS / 16;
+
+    // Scanline lookup grid: phi cells per scanline gap, largest number of inverse range cells, and points projected
+    // per cell, which bounds the cost of building the grid to a fraction of a full scan
+    constexpr int32_t SCANLINE_LOOKUP_PHI_BINS_PER_GAP = 4;
+    constexpr int32_t SCANLINE_LOOKUP_MAX_INV_RANGE_BINS = 64;
+    constexpr uint64_t SCANLINE_LOOKUP_POINTS_PER_CELL = 4;
+
+    // Relative slack on the round-trip bound of quantized ranges, which absorbs the rounding of their restoration
+    constexpr double QUANTIZATION_ERROR_SLACK = 1e-6;
 }
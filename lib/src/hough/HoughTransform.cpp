@@ -17,7 +17,7 @@ namespace alice_lri {
         xCount = std::floor((xMax - xMin + xStep) / xStep);
         yCount = std::floor((yMax - yMin + yStep) / yStep);
 
-        accumulator = Eigen::Matrix<int64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>(yCount, xCount);
+        accumulator = Eigen::Matrix<int32_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>(yCount, xCount);
         hashAccumulator = Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>(yCount, xCount);
 
         LOG_DEBUG("HoughTransform initialized with xCount: ", xCount, " yCount: ", yCount);
@@ -103,7 +103,7 @@ namespace alice_lri {
                 if (votes > maxVotes && votes > 0) {
                     maxVotes = votes;
                     maxIndices = {{x, y}};
-                } else if (votes == maxVotes) {
+                } else if (votes == maxVotes && votes > 0) {
                     maxIndices.emplace_back(x, y);
                 }
             }
@@ -135,11 +135,23 @@ namespace alice_lri {
 
     void HoughTransform::eraseByHash(const uint64_t hash) {
         PROFILE_SCOPE("HoughTransform::eraseByHash");
-        accumulator = (hashAccumulator.array() == hash).select(0, accumulator.array());
+        setVotesByHash(hash, 0);
     }
 
     void HoughTransform::restoreVotes(const uint64_t hash, const int64_t votes) {
-        accumulator = (hashAccumulator.array() == hash).select(votes, accumulator.array());
+        setVotesByHash(hash, static_cast<int32_t>(votes));
+    }
+
+    void HoughTransform::setVotesByHash(const uint64_t hash, const int32_t votes) {
+        // Only matching cells are written, so pages of the accumulator that no point voted for stay untouched
+        const uint64_t *const hashes = hashAccumulator.data();
+        int32_t *const cells = accumulator.data();
+
+        for (Eigen::Index i = 0; i < accumulator.size(); ++i) {
+            if (hashes[i] == hash) {
+                cells[i] = votes;
+            }
+        }
     }
 
     void HoughTransform::addVotes(const PointArray &points, const Eigen::ArrayXi &indices) {
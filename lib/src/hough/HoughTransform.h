@@ -14,7 +14,9 @@ namespace alice_lri {
      */
     class HoughTransform {
     private:
-        Eigen::Matrix<int64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> accumulator;
+        // A point adds at most two votes to a cell, one direct and one filling a discontinuity, so 32-bit counts
+        // cannot overflow for any supported point count and halve the traffic of the accumulator scans
+        Eigen::Matrix<int32_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> accumulator;
         Eigen::Matrix<uint64_t, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> hashAccumulator;
 
         double xMin;
@@ -138,6 +140,8 @@ namespace alice_lri {
             uint64_t pointIndex, int64_t x, int32_t y, int32_t previousY, HoughOperation operation, HoughMode mode
         );
 
+        void setVotesByHash(uint64_t hash, int32_t votes);
+
         HoughCell indicesToCell(const std::pair<int64_t, int64_t> &indices) const;
     };
 }
@@ -1,140 +1,550 @@
 #include "alice_lri/Core.hpp"
 
 #include "alice_lri/Result.hpp"
+#include "includeimpl/PreparedCloudAccess.h"
 #include "intrinsics/IntrinsicsEstimator.h"
+#include "point/CoordinateMaps.h"
+#include "point/PointUtils.h"
 #include "rangeimage/RangeImageUtils.h"
 #include "utils/json/JsonConverters.h"
 #include "utils/logger/Logger.h"
 #include "utils/Timer.h"
 
 namespace alice_lri {
-    template <typename Scalar>
-    Status validateInput(
-        const AliceArray<Scalar> &x, const AliceArray<Scalar> &y, const AliceArray<Scalar> &z
-    ) noexcept {
-        const bool equalSizes = x.size() == y.size() && y.size() == z.size();
+    template <typename Cloud>
+    Status validateSizes(const Cloud &points) noexcept {
+        const bool equalSizes = points.x.size() == points.y.size() && points.y.size() == points.z.size();
         if (!equalSizes) {
             return Status::buildError(ErrorCode::MISMATCHED_SIZES);
         }
 
-        if (x.empty() || y.empty() || z.empty()) {
+        return Status::buildOk();
+    }
+
+    PointCloud::FloatView toView(const PointCloud::Float &points) noexcept {
+        return {points.x.data(), points.y.data(), points.z.data(), points.x.size()};
+    }
+
+    PointCloud::DoubleView toView(const PointCloud::Double &points) noexcept {
+        return {points.x.data(), points.y.data(), points.z.data(), points.x.size()};
+    }
+
+    Status validateOptions(const EstimationOptions &options, const uint64_t pointsCount) noexcept {
+        if (options.scanlineLabels && options.scanlineLabelsCount != pointsCount) {
+            return Status::buildError(ErrorCode::MISMATCHED_SIZES);
+        }
+
+        return Status::buildOk();
+    }
+
+    // Single pass over the caller's buffers: the expression is evaluated lazily, so nothing is allocated
+    template <typename View>
+    Status validateInput(const View &points) noexcept {
+        if (points.size == 0 || !hasData(points)) {
             return Status::buildError(ErrorCode::EMPTY_POINT_CLOUD);
         }
 
-        const Eigen::ArrayXd xCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(x.data(), x.size()).template cast<double>();
-        const Eigen::ArrayXd yCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(y.data(), y.size()).template cast<double>();
-        const Eigen::ArrayXd zCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(z.data(), z.size()).template cast<double>();
+        if (!hasValidLayout(points)) {
+            return Status::buildError(ErrorCode::INVALID_LAYOUT);
+        }
+
+        const auto coordinates = mapCoordinates(points);
+        const auto x = coordinates.x.template cast<double>();
+        const auto y = coordinates.y.template cast<double>();
 
-        if ((xCast.square() + yCast.square()).minCoeff() <= 0) {
+        if ((x.square() + y.square()).minCoeff() <= 0) {
             return Status::buildError(ErrorCode::RANGES_XY_ZERO);
         }
 
         return Status::buildOk();
     }
 
-    template <typename Scalar>
-    Result<PointArray> validateAndBuildPointArray(
-        const AliceArray<Scalar> &x, const AliceArray<Scalar> &y, const AliceArray<Scalar> &z
-    ) noexcept {
-        const auto validationStatus = validateInput(x, y, z);
+    template <typename View>
+    Result<PointArray> validateAndBuildPointArray(const View &points) noexcept {
+        const auto validationStatus = validateInput(points);
         if (!validationStatus) {
             return Result<PointArray>(validationStatus);
         }
 
-        const Eigen::ArrayXd xCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(x.data(), x.size()).template cast<double>();
-        const Eigen::ArrayXd yCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(y.data(), y.size()).template cast<double>();
-        const Eigen::ArrayXd zCast = Eigen::Map<const Eigen::ArrayX<Scalar>>(z.data(), z.size()).template cast<double>();
+        // The only copy of the input, converted to contiguous doubles straight from the caller's buffers
+        const auto coordinates = mapCoordinates(points);
+        Eigen::ArrayXd x = coordinates.x.template cast<double>();
+        Eigen::ArrayXd y = coordinates.y.template cast<double>();
+        Eigen::ArrayXd z = coordinates.z.template cast<double>();
 
-        return Result(PointArray(xCast, yCast, zCast));
+        return Result(PointArray(std::move(x), std::move(y), std::move(z)));
     }
 
-    template <typename Scalar>
-    Result<Intrinsics> estimateIntrinsics(
-        const AliceArray<Scalar> &x, const AliceArray<Scalar> &y, const AliceArray<Scalar> &z
-    ) noexcept {
+    template <typename View>
+    Result<Intrinsics> estimateIntrinsicsFromView(const View &points, const EstimationOptions &options) noexcept {
         PROFILE_SCOPE("TOTAL");
         try {
-            const Result<PointArray> pointsResult = validateAndBuildPointArray(x, y, z);
+            const auto optionsStatus = validateOptions(options, points.size);
+            if (!optionsStatus) {
+                return Result<Intrinsics>(optionsStatus);
+            }
+
+            Result<PointArray> pointsResult = validateAndBuildPointArray(points);
 
             if (!pointsResult) {
                 return Result<Intrinsics>(pointsResult.status());
             }
 
-            return Result(IntrinsicsEstimator::estimate(*pointsResult));
+            return Result(IntrinsicsEstimator::estimate(std::move(pointsResult).value(), options));
         } catch (const std::exception &e) {
             return Result<Intrinsics>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
         }
     }
 
-    template <typename Scalar>
-    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
-        const AliceArray<Scalar> &x, const AliceArray<Scalar> &y, const AliceArray<Scalar> &z
+    template <typename View>
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailedFromView(
+        const View &points, const EstimationOptions &options
     ) noexcept {
         try {
             PROFILE_SCOPE("TOTAL");
-            const Result<PointArray> pointsResult = validateAndBuildPointArray(x, y, z);
+            const auto optionsStatus = validateOptions(options, points.size);
+            if (!optionsStatus) {
+                return Result<IntrinsicsDetailed>(optionsStatus);
+            }
+
+            Result<PointArray> pointsResult = validateAndBuildPointArray(points);
 
             if (!pointsResult) {
                 return Result<IntrinsicsDetailed>(pointsResult.status());
             }
 
-            return Result(IntrinsicsEstimator::estimateDetailed(*pointsResult));
+            return Result(IntrinsicsEstimator::estimateDetailed(std::move(pointsResult).value(), options));
         } catch (const std::exception &e) {
             return Result<IntrinsicsDetailed>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
         }
     }
 
+    template <typename Image, typename View>
+    Result<Image> projectViewToRangeImage(const Intrinsics &intrinsics, const View &points) noexcept {
+        try {
+            const auto validationStatus = validateInput(points);
+            if (!validationStatus) {
+                return Result<Image>(validationStatus);
+            }
+
+            if constexpr (std::is_same_v<Image, RaggedRangeImage>) {
+                return Result(RangeImageUtils::projectToRaggedRangeImage(intrinsics, mapCoordinates(points)));
+            } else {
+                return Result(RangeImageUtils::projectToRangeImage(intrinsics, mapCoordinates(points)));
+            }
+        } catch (const std::exception &e) {
+            return Result<Image>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+        }
+    }
+
+    // Coordinates are rounded by up to coordsEps, so ranges are stored with the same error bound
+    Result<QuantizedRangeImage> quantizeProjection(const RangeImage &image, const double coordsEps) {
+        std::optional<QuantizedRangeImage> quantized = RangeImageUtils::quantizeRangeImage(image, 2 * coordsEps);
+        if (!quantized) {
+            return Result<QuantizedRangeImage>(Status::buildError(ErrorCode::QUANTIZATION_ERROR));
+        }
+
+        return Result(std::move(*quantized));
+    }
+
+    // Projects in the precision of the caller's coordinates, like the unquantized overloads, and only measures the
+    // quantization step on them instead of building a point array
+    template <typename View>
+    Result<QuantizedRangeImage> projectViewToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const View &points
+    ) noexcept {
+        try {
+            const auto validationStatus = validateInput(points);
+            if (!validationStatus) {
+                return Result<QuantizedRangeImage>(validationStatus);
+            }
+
+            const auto coordinates = mapCoordinates(points);
+            const RangeImage image = RangeImageUtils::projectToRangeImage(intrinsics, coordinates);
+
+            return quantizeProjection(image, PointUtils::computeCoordsEps(coordinates));
+        } catch (const std::exception &e) {
+            return Result<QuantizedRangeImage>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+        }
+    }
+
+    template <typename View>
+    Result<PreparedCloud> prepareView(const View &points) noexcept {
+        PROFILE_SCOPE("TOTAL");
+        try {
+            Result<PointArray> pointsResult = validateAndBuildPointArray(points);
+
+            if (!pointsResult) {
+                return Result<PreparedCloud>(pointsResult.status());
+            }
+
+            return Result(PreparedCloudAccess::create(std::move(pointsResult).value()));
+        } catch (const std::exception &e) {
+            return Result<PreparedCloud>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+        }
+    }
+
+    template <typename T, typename Operation>
+    Result<T> withPreparedCloud(const PreparedCloud &points, Operation &&operation) noexcept {
+        const PointArray *pointArray = PreparedCloudAccess::points(points);
+        if (!pointArray) {
+            return Result<T>(Status::buildError(ErrorCode::EMPTY_POINT_CLOUD));
+        }
+
+        try {
+            return Result(operation(*pointArray));
+        } catch (const std::exception &e) {
+            return Result<T>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+        }
+    }
+
     Result<Intrinsics> estimateIntrinsics(const PointCloud::Float &points) noexcept {
-        const auto result = estimateIntrinsics(points.x, points.y, points.z);
+        return estimateIntrinsics(points, EstimationOptions());
+    }
+
+    Result<Intrinsics> estimateIntrinsics(const PointCloud::Double &points) noexcept {
+        return estimateIntrinsics(points, EstimationOptions());
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(const PointCloud::Float &points) noexcept {
+        return estimateIntrinsicsDetailed(points, EstimationOptions());
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(const PointCloud::Double &points) noexcept {
+        return estimateIntrinsicsDetailed(points, EstimationOptions());
+    }
+
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::Float &points, const EstimationOptions &options
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<Intrinsics>(sizesStatus);
+        }
+
+        return estimateIntrinsics(toView(points), options);
+    }
+
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::Double &points, const EstimationOptions &options
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<Intrinsics>(sizesStatus);
+        }
+
+        return estimateIntrinsics(toView(points), options);
+    }
+
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::FloatView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsFromView(points, options);
         PRINT_PROFILE_REPORT();
 
         return result;
     }
 
-    Result<Intrinsics> estimateIntrinsics(const PointCloud::Double &points) noexcept {
-        const auto result = estimateIntrinsics(points.x, points.y, points.z);
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::DoubleView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsFromView(points, options);
         PRINT_PROFILE_REPORT();
 
         return result;
     }
 
-    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(const PointCloud::Float &points) noexcept {
-        const auto result = estimateIntrinsicsDetailed(points.x, points.y, points.z);
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::Float &points, const EstimationOptions &options
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<IntrinsicsDetailed>(sizesStatus);
+        }
+
+        return estimateIntrinsicsDetailed(toView(points), options);
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::Double &points, const EstimationOptions &options
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<IntrinsicsDetailed>(sizesStatus);
+        }
+
+        return estimateIntrinsicsDetailed(toView(points), options);
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::FloatView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsDetailedFromView(points, options);
         PRINT_PROFILE_REPORT();
 
         return result;
     }
 
-    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(const PointCloud::Double &points) noexcept {
-        const auto result = estimateIntrinsicsDetailed(points.x, points.y, points.z);
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::DoubleView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsDetailedFromView(points, options);
         PRINT_PROFILE_REPORT();
 
         return result;
     }
 
     Result<RangeImage> projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Float &points) noexcept {
-        try {
-            const auto validationStatus = validateInput(points.x, points.y, points.z);
-            if (!validationStatus) {
-                return Result<RangeImage>(validationStatus);
-            }
-
-            return Result(RangeImageUtils::projectToRangeImage(intrinsics, points));
-        } catch (const std::exception &e) {
-            return Result<RangeImage>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<RangeImage>(sizesStatus);
         }
+
+        return projectToRangeImage(intrinsics, toView(points));
     }
 
     Result<RangeImage> projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Double &points) noexcept {
-        try {
-            const auto validationStatus = validateInput(points.x, points.y, points.z);
-            if (!validationStatus) {
-                return Result<RangeImage>(validationStatus);
-            }
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<RangeImage>(sizesStatus);
+        }
+
+        return projectToRangeImage(intrinsics, toView(points));
+    }
+
+    Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatView &points
+    ) noexcept {
+        return projectViewToRangeImage<RangeImage>(intrinsics, points);
+    }
+
+    Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleView &points
+    ) noexcept {
+        return projectViewToRangeImage<RangeImage>(intrinsics, points);
+    }
 
-            return Result(RangeImageUtils::projectToRangeImage(intrinsics, points));
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::FloatStridedView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsFromView(points, options);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<Intrinsics> estimateIntrinsics(
+        const PointCloud::DoubleStridedView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsFromView(points, options);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::FloatStridedView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsDetailedFromView(points, options);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PointCloud::DoubleStridedView &points, const EstimationOptions &options
+    ) noexcept {
+        const auto result = estimateIntrinsicsDetailedFromView(points, options);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatStridedView &points
+    ) noexcept {
+        return projectViewToRangeImage<RangeImage>(intrinsics, points);
+    }
+
+    Result<RangeImage> projectToRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleStridedView &points
+    ) noexcept {
+        return projectViewToRangeImage<RangeImage>(intrinsics, points);
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::Float &points) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<PreparedCloud>(sizesStatus);
+        }
+
+        return prepareCloud(toView(points));
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::Double &points) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<PreparedCloud>(sizesStatus);
+        }
+
+        return prepareCloud(toView(points));
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::FloatView &points) noexcept {
+        auto result = prepareView(points);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::DoubleView &points) noexcept {
+        auto result = prepareView(points);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::FloatStridedView &points) noexcept {
+        auto result = prepareView(points);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<PreparedCloud> prepareCloud(const PointCloud::DoubleStridedView &points) noexcept {
+        auto result = prepareView(points);
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<Intrinsics> estimateIntrinsics(const PreparedCloud &points, const EstimationOptions &options) noexcept {
+        const auto optionsStatus = validateOptions(options, points.size());
+        if (!optionsStatus) {
+            return Result<Intrinsics>(optionsStatus);
+        }
+
+        const auto result = withPreparedCloud<Intrinsics>(points, [&](const PointArray &pointArray) {
+            PROFILE_SCOPE("TOTAL");
+            return IntrinsicsEstimator::estimate(pointArray, options);
+        });
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<IntrinsicsDetailed> estimateIntrinsicsDetailed(
+        const PreparedCloud &points, const EstimationOptions &options
+    ) noexcept {
+        const auto optionsStatus = validateOptions(options, points.size());
+        if (!optionsStatus) {
+            return Result<IntrinsicsDetailed>(optionsStatus);
+        }
+
+        const auto result = withPreparedCloud<IntrinsicsDetailed>(points, [&](const PointArray &pointArray) {
+            PROFILE_SCOPE("TOTAL");
+            return IntrinsicsEstimator::estimateDetailed(pointArray, options);
+        });
+        PRINT_PROFILE_REPORT();
+
+        return result;
+    }
+
+    Result<RangeImage> projectToRangeImage(const Intrinsics &intrinsics, const PreparedCloud &points) noexcept {
+        return withPreparedCloud<RangeImage>(points, [&](const PointArray &pointArray) {
+            return RangeImageUtils::projectToRangeImage(intrinsics, pointArray);
+        });
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Float &points
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<RaggedRangeImage>(sizesStatus);
+        }
+
+        return projectToRaggedRangeImage(intrinsics, toView(points));
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Double &points
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<RaggedRangeImage>(sizesStatus);
+        }
+
+        return projectToRaggedRangeImage(intrinsics, toView(points));
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatView &points
+    ) noexcept {
+        return projectViewToRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleView &points
+    ) noexcept {
+        return projectViewToRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::FloatStridedView &points
+    ) noexcept {
+        return projectViewToRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::DoubleStridedView &points
+    ) noexcept {
+        return projectViewToRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    Result<RaggedRangeImage> projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const PreparedCloud &points
+    ) noexcept {
+        return withPreparedCloud<RaggedRangeImage>(points, [&](const PointArray &pointArray) {
+            return RangeImageUtils::projectToRaggedRangeImage(intrinsics, pointArray);
+        });
+    }
+
+    Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Float &points
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<QuantizedRangeImage>(sizesStatus);
+        }
+
+        return projectViewToQuantizedRangeImage(intrinsics, toView(points));
+    }
+
+    Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PointCloud::Double &points
+    ) noexcept {
+        const auto sizesStatus = validateSizes(points);
+        if (!sizesStatus) {
+            return Result<QuantizedRangeImage>(sizesStatus);
+        }
+
+        return projectViewToQuantizedRangeImage(intrinsics, toView(points));
+    }
+
+    Result<QuantizedRangeImage> projectToQuantizedRangeImage(
+        const Intrinsics &intrinsics, const PreparedCloud &points
+    ) noexcept {
+        const PointArray *pointArray = PreparedCloudAccess::points(points);
+        if (!pointArray) {
+            return Result<QuantizedRangeImage>(Status::buildError(ErrorCode::EMPTY_POINT_CLOUD));
+        }
+
+        try {
+            const RangeImage image = RangeImageUtils::projectToRangeImage(intrinsics, *pointArray);
+            return quantizeProjection(image, pointArray->getCoordsEps());
         } catch (const std::exception &e) {
-            return Result<RangeImage>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
+            return Result<QuantizedRangeImage>(Status::buildError(ErrorCode::INTERNAL_ERROR, AliceString(e.what())));
         }
     }
 
@@ -142,6 +552,18 @@ namespace alice_lri {
         return RangeImageUtils::unProjectToPointCloud(intrinsics, rangeImage);
     }
 
+    PointCloud::Double unProjectToPointCloud(
+        const Intrinsics &intrinsics, const RaggedRangeImage &rangeImage
+    ) noexcept {
+        return RangeImageUtils::unProjectToPointCloud(intrinsics, rangeImage);
+    }
+
+    PointCloud::Double unProjectToPointCloud(
+        const Intrinsics &intrinsics, const QuantizedRangeImage &rangeImage
+    ) noexcept {
+        return RangeImageUtils::unProjectToPointCloud(intrinsics, rangeImage.toRangeImage());
+    }
+
     Result<Intrinsics> intrinsicsFromJsonStr(const AliceString &json) noexcept {
         try {
             return Result(intrinsicsFromJson(json));
@@ -0,0 +1,168 @@
+#include "alice_lri/PointCloudReader.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include "io/PointFileLayout.h"
+#include "point/CoordinateMaps.h"
+#include "utils/logger/Logger.h"
+
+namespace alice_lri {
+    struct MappedPointCloud::Impl {
+        boost::interprocess::mapped_region region;
+        // Only filled when the mapped records cannot be read in place
+        std::vector<float> alignedRecords;
+        PointCloud::FloatStridedView view;
+    };
+
+    MappedPointCloud::MappedPointCloud(Impl *impl) noexcept : impl(impl) {}
+
+    MappedPointCloud::MappedPointCloud(MappedPointCloud &&o) noexcept : impl(std::exchange(o.impl, nullptr)) {}
+
+    MappedPointCloud &MappedPointCloud::operator=(MappedPointCloud &&o) noexcept {
+        if (this != &o) {
+            delete impl;
+            impl = std::exchange(o.impl, nullptr);
+        }
+        return *this;
+    }
+
+    MappedPointCloud::~MappedPointCloud() {
+        delete impl;
+    }
+
+    uint64_t MappedPointCloud::size() const noexcept {
+        return impl ? impl->view.size : 0;
+    }
+
+    PointCloud::FloatStridedView MappedPointCloud::view() const noexcept {
+        return impl ? impl->view : PointCloud::FloatStridedView{.base = nullptr, .size = 0};
+    }
+
+    // Maps the file and builds the opaque handle around it
+    class MappedPointCloudAccess {
+    public:
+        static Result<MappedPointCloud> map(const char *path, const PointFileFormat format) {
+            std::error_code error;
+            const uint64_t fileSize = std::filesystem::file_size(path, error);
+            if (error) {
+                LOG_WARN("Cannot read point cloud file ", path, ": ", error.message());
+                return Result<MappedPointCloud>(Status::buildError(ErrorCode::FILE_ERROR));
+            }
+
+            auto impl = std::make_unique<MappedPointCloud::Impl>();
+
+            // Empty files cannot be mapped, but are still valid headerless KITTI scans
+            if (fileSize > 0) {
+                const boost::interprocess::file_mapping file(path, boost::interprocess::read_only);
+                impl->region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+                impl->region.advise(boost::interprocess::mapped_region::advice_sequential);
+            }
+
+            const auto *data = static_cast<const std::byte *>(impl->region.get_address());
+            const std::string_view contents(reinterpret_cast<const char *>(data), impl->region.get_size());
+            const std::optional<PointFileLayout> layout = PointFileLayoutParser::parse(format, contents);
+
+            if (!layout) {
+                return Result<MappedPointCloud>(Status::buildError(ErrorCode::INVALID_FILE_FORMAT));
+            }
+
+            impl->view = {
+                .base = data + layout->dataOffset, .size = layout->pointsCount, .stride = layout->stride,
+                .xOffset = layout->xOffset, .yOffset = layout->yOffset, .zOffset = layout->zOffset
+            };
+
+            if (layout->pointsCount > 0 && !hasValidLayout(impl->view)) {
+                alignRecords(*impl, data + layout->dataOffset, *layout);
+            }
+
+            return Result<MappedPointCloud>(MappedPointCloud(impl.release()));
+        }
+
+    private:
+        // Copies the coordinates into tightly packed x, y, z records, which are always aligned
+        static void alignRecords(MappedPointCloud::Impl &impl, const std::byte *data, const PointFileLayout &layout) {
+            impl.alignedRecords.resize(3 * layout.pointsCount);
+
+            for (uint64_t i = 0; i < layout.pointsCount; ++i) {
+                const std::byte *record = data + i * layout.stride;
+                float *aligned = impl.alignedRecords.data() + 3 * i;
+                std::memcpy(aligned, record + layout.xOffset, sizeof(float));
+                std::memcpy(aligned + 1, record + layout.yOffset, sizeof(float));
+                std::memcpy(aligned + 2, record + layout.zOffset, sizeof(float));
+            }
+
+            impl.view = {
+                .base = impl.alignedRecords.data(), .size = layout.pointsCount, .stride = 3 * sizeof(float)
+            };
+        }
+    };
+
+    Result<MappedPointCloud> mapPointCloudFile(const char *path, PointFileFormat format) noexcept {
+        try {
+            if (format == PointFileFormat::AUTO) {
+                format = PointFileLayoutParser::detectFormat(path);
+            }
+
+            return MappedPointCloudAccess::map(path, format);
+        } catch (const boost::interprocess::interprocess_exception &e) {
+            LOG_WARN("Cannot map point cloud file ", path, ": ", e.what());
+            return Result<MappedPointCloud>(Status::buildError(ErrorCode::FILE_ERROR));
+        } catch (...) {
+            return Result<MappedPointCloud>(Status::buildError(ErrorCode::INTERNAL_ERROR));
+        }
+    }
+
+    // Copies the coordinates of the mapped file into a cloud of the requested precision
+    template<typename Cloud>
+    Result<Cloud> readCloud(const char *path, const PointFileFormat format) noexcept {
+        try {
+            const Result<MappedPointCloud> mapped = mapPointCloudFile(path, format);
+            if (!mapped) {
+                return Result<Cloud>(mapped.status());
+            }
+
+            const PointCloud::FloatStridedView view = mapped->view();
+            if (view.size == 0) {
+                return Result<Cloud>(Cloud());
+            }
+
+            // Sensors report missing returns as points at the origin, which are dropped in a single masked pass
+            const StridedCoordinateMaps<float> maps = mapCoordinates(view);
+            const Eigen::ArrayX<bool> keep = maps.x != 0.0f || maps.y != 0.0f || maps.z != 0.0f;
+
+            Cloud cloud;
+            const auto keptCount = static_cast<uint64_t>(keep.count());
+            cloud.x.resize(keptCount);
+            cloud.y.resize(keptCount);
+            cloud.z.resize(keptCount);
+
+            uint64_t kept = 0;
+            for (Eigen::Index i = 0; i < keep.size(); ++i) {
+                if (keep[i]) {
+                    cloud.x[kept] = maps.x[i];
+                    cloud.y[kept] = maps.y[i];
+                    cloud.z[kept] = maps.z[i];
+                    ++kept;
+                }
+            }
+
+            return Result<Cloud>(std::move(cloud));
+        } catch (...) {
+            return Result<Cloud>(Status::buildError(ErrorCode::INTERNAL_ERROR));
+        }
+    }
+
+    Result<PointCloud::Float> readPointCloudFile(const char *path, const PointFileFormat format) noexcept {
+        return readCloud<PointCloud::Float>(path, format);
+    }
+
+    Result<PointCloud::Double> readPointCloudFileDouble(const char *path, const PointFileFormat format) noexcept {
+        return readCloud<PointCloud::Double>(path, format);
+    }
+}
@@ -0,0 +1,38 @@
+#include "alice_lri/PreparedCloud.hpp"
+
+#include <utility>
+#include "PreparedCloudAccess.h"
+
+namespace alice_lri {
+    struct PreparedCloud::Impl {
+        PointArray points;
+    };
+
+    PreparedCloud::PreparedCloud(Impl *impl) noexcept : impl(impl) {}
+
+    PreparedCloud::PreparedCloud(PreparedCloud &&o) noexcept : impl(std::exchange(o.impl, nullptr)) {}
+
+    PreparedCloud &PreparedCloud::operator=(PreparedCloud &&o) noexcept {
+        if (this != &o) {
+            delete impl;
+            impl = std::exchange(o.impl, nullptr);
+        }
+        return *this;
+    }
+
+    PreparedCloud::~PreparedCloud() {
+        delete impl;
+    }
+
+    uint64_t PreparedCloud::size() const noexcept {
+        return impl ? impl->points.size() : 0;
+    }
+
+    PreparedCloud PreparedCloudAccess::create(PointArray &&points) {
+        return PreparedCloud(new PreparedCloud::Impl{std::move(points)});
+    }
+
+    const PointArray *PreparedCloudAccess::points(const PreparedCloud &cloud) {
+        return cloud.impl ? &cloud.impl->points : nullptr;
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+#include "alice_lri/PreparedCloud.hpp"
+#include "point/PointArray.h"
+
+namespace alice_lri {
+    // Bridge between the opaque public handle and the point array it wraps
+    class PreparedCloudAccess {
+    public:
+        static PreparedCloud create(PointArray &&points);
+        // Null for a moved-from handle
+        static const PointArray *points(const PreparedCloud &cloud);
+    };
+}
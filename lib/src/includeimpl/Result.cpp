@@ -13,6 +13,14 @@ namespace alice_lri {
                 return AliceString("Point cloud contains points at (x,y) = (0,0): geometric error");
             case ErrorCode::INTERNAL_ERROR:
                 return AliceString("Internal error");
+            case ErrorCode::INVALID_LAYOUT:
+                return AliceString("Point record base, stride or offsets are misaligned, or a coordinate lies outside its record");
+            case ErrorCode::FILE_ERROR:
+                return AliceString("Point cloud file cannot be opened or mapped");
+            case ErrorCode::INVALID_FILE_FORMAT:
+                return AliceString("Point cloud file is malformed or does not store binary float32 coordinates");
+            case ErrorCode::QUANTIZATION_ERROR:
+                return AliceString("Ranges cannot be stored as fixed-point codes within the round-trip error bound");
             default:
                 return AliceString("Unknown data validation error");
         }
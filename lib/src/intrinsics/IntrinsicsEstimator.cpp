@@ -1,11 +1,50 @@
 #include "IntrinsicsEstimator.h"
+#include "intrinsics/vertical/VerticalLabelledEstimator.h"
+#include "intrinsics/vertical/estimation/VerticalScanlineAssigner.h"
+#include "point/PointSubsampler.h"
+#include "utils/logger/Logger.h"
 
 namespace alice_lri {
 
-    Intrinsics IntrinsicsEstimator::estimate(const PointArray &points) {
-        const VerticalIntrinsicsEstimation vertical = VerticalIntrinsicsEstimator::estimate(points);
-        const HorizontalIntrinsicsEstimation horizontal = HorizontalIntrinsicsEstimator::estimate(points, vertical);
+    Intrinsics IntrinsicsEstimator::estimate(const PointArray &points, const EstimationOptions &options) {
+        return makeIntrinsics(estimateStages(points, nullptr, options));
+    }
+
+    IntrinsicsDetailed IntrinsicsEstimator::estimateDetailed(const PointArray &points, const EstimationOptions &options) {
+        return makeIntrinsicsDetailed(points, estimateStages(points, nullptr, options));
+    }
+
+    Intrinsics IntrinsicsEstimator::estimate(PointArray &&points, const EstimationOptions &options) {
+        return makeIntrinsics(estimateStages(points, &points, options));
+    }
+
+    IntrinsicsDetailed IntrinsicsEstimator::estimateDetailed(PointArray &&points, const EstimationOptions &options) {
+        return makeIntrinsicsDetailed(points, estimateStages(points, &points, options));
+    }
+
+    IntrinsicsEstimator::Estimation IntrinsicsEstimator::estimateStages(
+        const PointArray &points, PointArray *ownedPoints, const EstimationOptions &options
+    ) {
+        const std::optional<Eigen::ArrayXi> subsampleIndices = computeSubsampleIndices(points, options);
+        std::optional<PointArray> subsample = subsampleIndices
+            ? std::make_optional(points.select(*subsampleIndices)) : std::nullopt;
+        const PointArray &estimationPoints = subsample ? *subsample : points;
+
+        VerticalIntrinsicsEstimation vertical = estimateVertical(
+            estimationPoints, selectLabels(options, subsampleIndices)
+        );
+
+        // Only arrays owned by this estimation may release their fields, as a shared one may be read concurrently
+        PointArray *releasablePoints = subsample ? &*subsample : ownedPoints;
+        HorizontalIntrinsicsEstimation horizontal = releasablePoints
+            ? HorizontalIntrinsicsEstimator::estimateReleasingFields(*releasablePoints, vertical)
+            : HorizontalIntrinsicsEstimator::estimate(estimationPoints, vertical);
+
+        return {std::move(vertical), std::move(horizontal), subsample.has_value()};
+    }
 
+    Intrinsics IntrinsicsEstimator::makeIntrinsics(const Estimation &estimation) {
+        const auto &[vertical, horizontal, subsampled] = estimation;
         const int32_t scanlinesCount = static_cast<int32_t>(vertical.scanlinesAssignations.scanlines.size());
         Intrinsics intrinsics(scanlinesCount);
 
@@ -19,9 +58,12 @@ namespace alice_lri {
         return intrinsics;
     }
 
-    IntrinsicsDetailed IntrinsicsEstimator::estimateDetailed(const PointArray &points) {
-        const VerticalIntrinsicsEstimation vertical = VerticalIntrinsicsEstimator::estimate(points);
-        const HorizontalIntrinsicsEstimation horizontal = HorizontalIntrinsicsEstimator::estimate(points, vertical);
+    IntrinsicsDetailed IntrinsicsEstimator::makeIntrinsicsDetailed(const PointArray &points, Estimation &&estimation) {
+        auto &[vertical, horizontal, subsampled] = estimation;
+
+        if (subsampled) {
+            VerticalScanlineAssigner::assignAllPoints(points, vertical);
+        }
 
         const int32_t scanlinesCount = static_cast<int32_t>(vertical.scanlinesAssignations.scanlines.size());
         IntrinsicsDetailed intrinsics(scanlinesCount, vertical.iterations, vertical.unassignedPoints,
@@ -37,6 +79,45 @@ namespace alice_lri {
         return intrinsics;
     }
 
+    std::optional<Eigen::ArrayXi> IntrinsicsEstimator::computeSubsampleIndices(
+        const PointArray &points, const EstimationOptions &options
+    ) {
+        if (!PointSubsampler::shouldSubsample(points, options.subsampleSize)) {
+            return std::nullopt;
+        }
+
+        LOG_INFO("Estimating on a subsample of ", options.subsampleSize, " out of ", points.size(), " points");
+        return PointSubsampler::stratifiedIndices(points, options.subsampleSize);
+    }
+
+    std::optional<Eigen::ArrayXi> IntrinsicsEstimator::selectLabels(
+        const EstimationOptions &options, const std::optional<Eigen::ArrayXi> &subsampleIndices
+    ) {
+        if (!options.scanlineLabels) {
+            return std::nullopt;
+        }
+
+        const Eigen::Map<const Eigen::ArrayXi> labels(
+            options.scanlineLabels, static_cast<Eigen::Index>(options.scanlineLabelsCount)
+        );
+        return subsampleIndices ? Eigen::ArrayXi(labels(*subsampleIndices)) : Eigen::ArrayXi(labels);
+    }
+
+    VerticalIntrinsicsEstimation IntrinsicsEstimator::estimateVertical(
+        const PointArray &points, const std::optional<Eigen::ArrayXi> &labels
+    ) {
+        if (labels) {
+            std::optional<VerticalIntrinsicsEstimation> labelled = VerticalLabelledEstimator::estimate(points, *labels);
+            if (labelled) {
+                return std::move(*labelled);
+            }
+
+            LOG_WARN("Warning: Scanline labels are inconsistent, falling back to the full search");
+        }
+
+        return VerticalIntrinsicsEstimator::estimate(points);
+    }
+
     Scanline IntrinsicsEstimator::makeScanline(
         const VerticalScanline &vertical, const HorizontalScanline &horizontal
     ) {
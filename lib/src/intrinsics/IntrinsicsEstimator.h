@@ -1,4 +1,5 @@
 #pragma once
+#include <optional>
 #include "alice_lri/Structs.hpp"
 #include "horizontal/HorizontalIntrinsicsEstimator.h"
 #include "point/PointArray.h"
@@ -8,10 +9,37 @@ namespace alice_lri {
     class IntrinsicsEstimator {
 
     public:
-        static Intrinsics estimate(const PointArray &points);
-        static IntrinsicsDetailed estimateDetailed(const PointArray &points);
+        // Shared point arrays, such as the one of a prepared cloud, are only read
+        static Intrinsics estimate(const PointArray &points, const EstimationOptions &options = {});
+        static IntrinsicsDetailed estimateDetailed(const PointArray &points, const EstimationOptions &options = {});
+
+        // Point arrays built for a single estimation release their horizontal fields once they are consumed
+        static Intrinsics estimate(PointArray &&points, const EstimationOptions &options = {});
+        static IntrinsicsDetailed estimateDetailed(PointArray &&points, const EstimationOptions &options = {});
 
     private:
+        struct Estimation {
+            VerticalIntrinsicsEstimation vertical;
+            HorizontalIntrinsicsEstimation horizontal;
+            bool subsampled;
+        };
+
+        static Estimation estimateStages(
+            const PointArray &points, PointArray *ownedPoints, const EstimationOptions &options
+        );
+        static Intrinsics makeIntrinsics(const Estimation &estimation);
+        static IntrinsicsDetailed makeIntrinsicsDetailed(const PointArray &points, Estimation &&estimation);
+
+        static std::optional<Eigen::ArrayXi> computeSubsampleIndices(
+            const PointArray &points, const EstimationOptions &options
+        );
+        static std::optional<Eigen::ArrayXi> selectLabels(
+            const EstimationOptions &options, const std::optional<Eigen::ArrayXi> &subsampleIndices
+        );
+        static VerticalIntrinsicsEstimation estimateVertical(
+            const PointArray &points, const std::optional<Eigen::ArrayXi> &labels
+        );
+
         static Scanline makeScanline(const VerticalScanline &vertical, const HorizontalScanline &horizontal);
         static ScanlineDetailed makeDetailedScanline(const VerticalScanline &vertical, const HorizontalScanline &horizontal);
     };
@@ -1,39 +1,76 @@
 #include "HorizontalIntrinsicsEstimator.h"
 #include <Eigen/Dense>
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <numbers>
+#include <numeric>
 #include <limits>
+#include <set>
 #include <unordered_set>
 #include <vector>
 
 #include "Constants.h"
 #include "BuildOptions.h"
+#include "intrinsics/horizontal/helper/CandidateEvaluationScratch.h"
 #include "intrinsics/horizontal/helper/HorizontalMath.h"
 #include "intrinsics/horizontal/helper/HorizontalScanlineArray.h"
+#include "intrinsics/horizontal/helper/ResolutionCandidateGenerator.h"
 #include "intrinsics/horizontal/helper/SegmentedMedianLinearRegressor.h"
 #include "helper/PeriodicFitter.h"
 #include "intrinsics/horizontal/HorizontalIntrinsicsStructs.h"
 #include "math/Stats.h"
 #include "utils/logger/Logger.h"
+#include "utils/Parallel.h"
 #include "utils/Timer.h"
 #include "utils/Utils.h"
 
+constexpr int64_t RESOLUTION_SWEEP_GRAIN_SIZE = 32;
+constexpr std::array<int64_t, 2> RACING_STRIDES = {16, 4};
+constexpr int64_t RACING_MIN_POINTS = 128;
+constexpr size_t RACING_MIN_SURVIVORS = 8;
+constexpr double RACING_LOSS_RATIO = 8;
+
 namespace alice_lri {
     HorizontalIntrinsicsEstimation HorizontalIntrinsicsEstimator::estimate(
         const PointArray &points, const VerticalIntrinsicsEstimation &vertical
     ) {
         PROFILE_SCOPE("HorizontalIntrinsicsEstimator::estimate");
-        HorizontalIntrinsicsEstimation result;
         const int32_t scanlinesCount = vertical.scanlinesAssignations.scanlines.size();
-        result.scanlines.resize(scanlinesCount);
+        const HorizontalScanlineArray scanlineArray(
+            points, vertical.scanlinesAssignations.pointsScanlinesIds, scanlinesCount, SortingCriteria::RANGES_XY
+        );
 
+        return estimate(scanlineArray, scanlinesCount);
+    }
+
+    HorizontalIntrinsicsEstimation HorizontalIntrinsicsEstimator::estimateReleasingFields(
+        PointArray &points, const VerticalIntrinsicsEstimation &vertical
+    ) {
+        PROFILE_SCOPE("HorizontalIntrinsicsEstimator::estimate");
+        const int32_t scanlinesCount = vertical.scanlinesAssignations.scanlines.size();
         const HorizontalScanlineArray scanlineArray(
             points, vertical.scanlinesAssignations.pointsScanlinesIds, scanlinesCount, SortingCriteria::RANGES_XY
         );
+        // The scanline array holds its own copies, so the point fields are no longer needed
+        points.releaseHorizontalFields();
+
+        return estimate(scanlineArray, scanlinesCount);
+    }
+
+    HorizontalIntrinsicsEstimation HorizontalIntrinsicsEstimator::estimate(
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlinesCount
+    ) {
+        HorizontalIntrinsicsEstimation result;
+        result.scanlines.resize(scanlinesCount);
+
+        const std::vector<std::optional<HorizontalScanline>> estimations = estimateScanlines(
+            scanlineArray, scanlinesCount
+        );
 
         std::unordered_set<int32_t> heuristicScanlines;
         for (int32_t scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
-            const std::optional<HorizontalScanline> info = estimateScanline(scanlineArray, scanlineIdx);
+            const std::optional<HorizontalScanline> &info = estimations[scanlineIdx];
 
             if (info) {
                 result.scanlines[scanlineIdx] = *info;
@@ -56,8 +93,44 @@ namespace alice_lri {
         return result;
     }
 
+    std::vector<std::optional<HorizontalScanline>> HorizontalIntrinsicsEstimator::estimateScanlines(
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlinesCount
+    ) {
+        std::vector<int32_t> scanlinesOrder(scanlinesCount);
+        std::iota(scanlinesOrder.begin(), scanlinesOrder.end(), 0);
+        std::ranges::stable_sort(scanlinesOrder, [&scanlineArray](const int32_t a, const int32_t b) {
+            return scanlineArray.getSize(a) > scanlineArray.getSize(b);
+        });
+
+        // Scanlines are processed in waves of doubling size, from the most populated to the least. Every wave can use
+        // the resolutions found in the previous ones as hints, which keeps the result independent of the scheduling.
+        std::vector<std::optional<HorizontalScanline>> estimations(scanlinesCount);
+        std::set<int32_t> resolutionHints;
+
+        for (int32_t waveStart = 0, waveSize = 1; waveStart < scanlinesCount; waveStart += waveSize, waveSize *= 2) {
+            const int32_t waveEnd = std::min(waveStart + waveSize, scanlinesCount);
+            const std::vector<int32_t> waveHints(resolutionHints.begin(), resolutionHints.end());
+
+            Parallel::parallelFor(waveStart, waveEnd, [&](const int64_t i) {
+                const int32_t scanlineIdx = scanlinesOrder[i];
+                estimations[scanlineIdx] = estimateScanline(scanlineArray, scanlineIdx, waveHints);
+            });
+
+            for (int32_t i = waveStart; i < waveEnd; ++i) {
+                const std::optional<HorizontalScanline> &estimation = estimations[scanlinesOrder[i]];
+
+                if (estimation) {
+                    resolutionHints.insert(estimation->resolution);
+                }
+            }
+        }
+
+        return estimations;
+    }
+
     std::optional<HorizontalScanline> HorizontalIntrinsicsEstimator::estimateScanline(
-        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx,
+        const std::vector<int32_t> &resolutionHints
     ) {
         LOG_DEBUG("Processing horizontal scanline: ", scanlineIdx);
 
@@ -73,7 +146,7 @@ namespace alice_lri {
             }
         }
 
-        const auto optimizeResult = findOptimalHorizontalParameters(scanlineArray, scanlineIdx);
+        const auto optimizeResult = findOptimalHorizontalParameters(scanlineArray, scanlineIdx, resolutionHints);
 
         if (!optimizeResult) {
             LOG_INFO("Horizontal optimization failed for scanline ", scanlineIdx);
@@ -99,30 +172,127 @@ namespace alice_lri {
     }
 
     std::optional<ResolutionOffsetLoss> HorizontalIntrinsicsEstimator::findOptimalHorizontalParameters(
-        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx,
+        const std::vector<int32_t> &resolutionHints
     ) {
         const int32_t scanlineSize = scanlineArray.getSize(scanlineIdx);
-        std::optional<ResolutionOffsetLoss> bestCandidate = std::nullopt;
 
-        for (int32_t resolution = scanlineSize; resolution <= Constant::MAX_RESOLUTION; ++resolution) {
-            const ResolutionOffsetLoss candidate = optimizeJointCandidateResolution(
-                scanlineArray, scanlineIdx, resolution
+        if constexpr (BuildOptions::USE_HORIZONTAL_RESOLUTION_HINTS) {
+            for (const int32_t hint : resolutionHints) {
+                const std::optional<ResolutionOffsetLoss> hintCandidate = tryResolutionHint(
+                    scanlineArray, scanlineIdx, hint
+                );
+
+                if (hintCandidate) {
+                    LOG_DEBUG("Accepted resolution hint ", hint, " for scanline ", scanlineIdx);
+                    return hintCandidate;
+                }
+            }
+        }
+
+        if constexpr (BuildOptions::USE_HORIZONTAL_RESOLUTION_CANDIDATES) {
+            const std::optional<std::vector<int32_t>> candidateResolutions = ResolutionCandidateGenerator::generate(
+                scanlineArray.getThetas(scanlineIdx), scanlineSize
             );
 
+            if (candidateResolutions) {
+                const std::optional<ResolutionOffsetLoss> bestCandidate = findBestCandidateResolution(
+                    scanlineArray, scanlineIdx, *candidateResolutions
+                );
+
+                if (bestCandidate && bestCandidate->loss < Constant::HORIZONTAL_CANDIDATE_MAX_LOSS) {
+                    return bestCandidate;
+                }
+            }
+
+            LOG_DEBUG("No confident candidate resolutions for scanline ", scanlineIdx, ", performing full sweep");
+        }
+
+        std::vector<int32_t> allResolutions;
+        for (int32_t resolution = scanlineSize; resolution <= Constant::MAX_RESOLUTION; ++resolution) {
+            allResolutions.emplace_back(resolution);
+        }
+
+        return findBestCandidateResolution(scanlineArray, scanlineIdx, allResolutions);
+    }
+
+    std::optional<ResolutionOffsetLoss> HorizontalIntrinsicsEstimator::tryResolutionHint(
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx, const int32_t hint
+    ) {
+        const int32_t scanlineSize = scanlineArray.getSize(scanlineIdx);
+        if (hint < scanlineSize) {
+            return std::nullopt;
+        }
+
+        // The hint is only accepted if it also beats its neighbours and all its divisors the scanline fits in. A hint
+        // that is a multiple of the true resolution fits the points as well as it does, so the divisors must be tried
+        std::vector<int32_t> resolutions;
+        for (int32_t divisor = hint / scanlineSize; divisor >= 2; --divisor) {
+            if (hint % divisor == 0) {
+                resolutions.emplace_back(hint / divisor);
+            }
+        }
+
+        for (int32_t resolution = std::max(hint - 1, scanlineSize); resolution <= hint + 1; ++resolution) {
+            if (resolution <= Constant::MAX_RESOLUTION) {
+                resolutions.emplace_back(resolution);
+            }
+        }
+
+        const std::optional<ResolutionOffsetLoss> bestCandidate = findBestCandidateResolution(
+            scanlineArray, scanlineIdx, resolutions
+        );
+
+        if (!bestCandidate || bestCandidate->resolution != hint) {
+            return std::nullopt;
+        }
+
+        if (bestCandidate->loss >= Constant::HORIZONTAL_HINT_MAX_LOSS) {
+            return std::nullopt;
+        }
+
+        return bestCandidate;
+    }
+
+    std::optional<ResolutionOffsetLoss> HorizontalIntrinsicsEstimator::findBestCandidateResolution(
+        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx, const std::vector<int32_t> &resolutions,
+        const bool racing
+    ) {
+        const auto thetas = scanlineArray.getThetas(scanlineIdx);
+        const auto invRangesXy = scanlineArray.getInvRangesXy(scanlineIdx);
+
+        std::vector<int32_t> survivors = resolutions;
+        if (racing) {
+            for (const int64_t stride : RACING_STRIDES) {
+                if (thetas.size() / stride < RACING_MIN_POINTS || survivors.size() <= RACING_MIN_SURVIVORS) {
+                    continue;
+                }
+
+                const auto subset = Eigen::seq(0, thetas.size() - 1, stride);
+                survivors = raceCandidateResolutions(thetas(subset), invRangesXy(subset), survivors);
+            }
+        }
+
+        const std::vector<std::optional<ResolutionOffsetLoss>> candidates = evaluateCandidateResolutions(
+            thetas, invRangesXy, survivors
+        );
+        std::optional<ResolutionOffsetLoss> bestCandidate = std::nullopt;
+
+        for (const std::optional<ResolutionOffsetLoss> &candidate : candidates) {
             LOG_DEBUG(
-                "Candidate resolution: ", candidate.resolution, ", offset: ", candidate.offset,
-                "theta offset: ", candidate.thetaOffset, ", loss: ", candidate.loss
+                "Candidate resolution: ", candidate->resolution, ", offset: ", candidate->offset,
+                "theta offset: ", candidate->thetaOffset, ", loss: ", candidate->loss
             );
 
-            if (std::abs(candidate.offset) > Constant::MAX_OFFSET || !std::isfinite(candidate.offset)) {
+            if (!isValidCandidate(*candidate)) {
                 continue;
             }
 
-            if (!bestCandidate || candidate.loss < bestCandidate->loss) {
+            if (!bestCandidate || candidate->loss < bestCandidate->loss) {
                 bestCandidate = candidate;
                 LOG_DEBUG(
-                    "New best resolution: ", candidate.resolution, ", offset: ", candidate.offset,
-                    "theta offset: ", candidate.thetaOffset, ", loss: ", candidate.loss
+                    "New best resolution: ", candidate->resolution, ", offset: ", candidate->offset,
+                    "theta offset: ", candidate->thetaOffset, ", loss: ", candidate->loss
                 );
             }
         }
@@ -130,20 +300,76 @@ namespace alice_lri {
         return bestCandidate;
     }
 
+    std::vector<int32_t> HorizontalIntrinsicsEstimator::raceCandidateResolutions(
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+        const std::vector<int32_t> &resolutions
+    ) {
+        PROFILE_SCOPE("HorizontalIntrinsicsEstimator::raceCandidateResolutions");
+        const std::vector<std::optional<ResolutionOffsetLoss>> candidates = evaluateCandidateResolutions(
+            thetas, invRangesXy, resolutions
+        );
+
+        std::vector<double> validLosses;
+        for (const std::optional<ResolutionOffsetLoss> &candidate : candidates) {
+            if (isValidCandidate(*candidate)) {
+                validLosses.emplace_back(candidate->loss);
+            }
+        }
+
+        if (validLosses.size() <= RACING_MIN_SURVIVORS) {
+            return resolutions;
+        }
+
+        // Candidates are kept if they are among the best few, or if their loss is within a wide factor of the best
+        // one. Candidates that are invalid on the subset are kept too, since they might not be on the full data.
+        std::ranges::nth_element(validLosses, validLosses.begin() + RACING_MIN_SURVIVORS - 1);
+        const double minSurvivorsLoss = validLosses[RACING_MIN_SURVIVORS - 1];
+        const double bestLoss = *std::ranges::min_element(validLosses);
+        const double maxLoss = std::max(minSurvivorsLoss, bestLoss * RACING_LOSS_RATIO);
+
+        std::vector<int32_t> survivors;
+        for (const std::optional<ResolutionOffsetLoss> &candidate : candidates) {
+            if (!isValidCandidate(*candidate) || candidate->loss <= maxLoss) {
+                survivors.emplace_back(candidate->resolution);
+            }
+        }
+
+        LOG_DEBUG("Racing kept ", survivors.size(), " out of ", resolutions.size(), " resolutions");
+        return survivors;
+    }
+
+    std::vector<std::optional<ResolutionOffsetLoss>> HorizontalIntrinsicsEstimator::evaluateCandidateResolutions(
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+        const std::vector<int32_t> &resolutions
+    ) {
+        const auto candidatesCount = static_cast<int64_t>(resolutions.size());
+        std::vector<std::optional<ResolutionOffsetLoss>> candidates(candidatesCount);
+
+        Parallel::parallelFor(0, candidatesCount, [&](const int64_t i) {
+            candidates[i] = optimizeJointCandidateResolution(thetas, invRangesXy, resolutions[i]);
+        }, RESOLUTION_SWEEP_GRAIN_SIZE);
+
+        return candidates;
+    }
+
+    bool HorizontalIntrinsicsEstimator::isValidCandidate(const ResolutionOffsetLoss &candidate) {
+        return std::abs(candidate.offset) <= Constant::MAX_OFFSET && std::isfinite(candidate.offset);
+    }
+
     ResolutionOffsetLoss HorizontalIntrinsicsEstimator::optimizeJointCandidateResolution(
-        const HorizontalScanlineArray &scanlineArray, const int32_t scanlineIdx, const int32_t resolution
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+        const int32_t resolution
     ) {
         LOG_DEBUG("Candidate resolution: ", resolution);
 
         const double thetaStep = 2 * std::numbers::pi / resolution;
-        const Eigen::ArrayXd &invRangesXy = scanlineArray.getInvRangesXy(scanlineIdx);
+        const Eigen::Index pointsCount = thetas.size();
 
-        const Eigen::ArrayXd diffToIdeal = HorizontalMath::computeDiffToIdeal(
-            scanlineArray.getThetas(scanlineIdx), resolution, false
-        );
-        const Eigen::ArrayXd diffToIdealReconstructed = HorizontalMath::computeDiffToIdeal(
-            scanlineArray.getThetas(scanlineIdx), resolution, true
-        );
+        thread_local CandidateEvaluationScratch scratch;
+        scratch.reserve(pointsCount);
+        auto diffToIdeal = scratch.diffToIdeal.head(pointsCount);
+        auto diffToIdealReconstructed = scratch.diffToIdealReconstructed.head(pointsCount);
+        HorizontalMath::computeDiffToIdeal(thetas, resolution, diffToIdeal, diffToIdealReconstructed);
 
         const SegmentedMedianLinearRegressor segmentedRegressor(
             Constant::INV_RANGES_SEGMENT_THRESHOLD, thetaStep / 4, Constant::MAX_OFFSET, thetaStep
@@ -151,7 +377,10 @@ namespace alice_lri {
         const LRResult lrGuess = segmentedRegressor.fit(invRangesXy, diffToIdealReconstructed);
 
         LOG_DEBUG("Slope guess: ", lrGuess.slope, ", Intercept guess: ", lrGuess.intercept);
-        const LRResult fitResult = PeriodicFitter::fit(invRangesXy, diffToIdeal, thetaStep, lrGuess.slope);
+        const LRResult fitResult = PeriodicFitter::fit(
+            invRangesXy, diffToIdeal, thetaStep, lrGuess.slope, scratch.residuals.head(pointsCount),
+            scratch.shiftedY.head(pointsCount)
+        );
 
         return ResolutionOffsetLoss(
             resolution,
@@ -169,8 +398,8 @@ namespace alice_lri {
         const std::unordered_set<double> otherOffsets = getUniqueOffsets(scanlines, heuristicScanlines);
 
         for (const int32_t scanlineIdx: heuristicScanlines) {
-            const Eigen::ArrayXd &thetas = scanlineArray.getThetas(scanlineIdx);
-            const Eigen::ArrayXd &rangesXy = scanlineArray.getRangesXy(scanlineIdx);
+            const auto thetas = scanlineArray.getThetas(scanlineIdx);
+            const auto rangesXy = scanlineArray.getRangesXy(scanlineIdx);
 
             const ResolutionOffsetLoss bestParams = optimizeFromCandidatesHeuristic(
                 thetas, rangesXy, otherResolutions, otherOffsets
@@ -236,8 +465,8 @@ namespace alice_lri {
     }
 
     ResolutionOffsetLoss HorizontalIntrinsicsEstimator::optimizeFromCandidatesHeuristic(
-        const Eigen::ArrayXd &thetas,
-        const Eigen::ArrayXd &ranges,
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas,
+        const Eigen::Ref<const Eigen::ArrayXd> &ranges,
         const std::unordered_set<int32_t> &candidateResolutions,
         const std::unordered_set<double> &candidateOffsets
     ) {
@@ -257,7 +486,8 @@ namespace alice_lri {
     }
 
     ResolutionOffsetLoss HorizontalIntrinsicsEstimator::computeHeuristicValues(
-        const Eigen::ArrayXd &thetas, const Eigen::ArrayXd &ranges, const int32_t resolution, const double offset
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &ranges,
+        const int32_t resolution, const double offset
     ) {
         const double thetaStep = Constant::TWO_PI / resolution;
         Eigen::ArrayXd correctedThetas = thetas - offset / ranges;
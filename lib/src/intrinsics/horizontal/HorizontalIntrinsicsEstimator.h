@@ -2,6 +2,7 @@
 #include <optional>
 #include <unordered_set>
 
+#include "BuildOptions.h"
 #include "intrinsics/horizontal/HorizontalIntrinsicsStructs.h"
 #include "intrinsics/horizontal/helper/HorizontalScanlineArray.h"
 #include "intrinsics/vertical/VerticalIntrinsicsStructs.h"
@@ -21,22 +22,60 @@ namespace alice_lri {
     class HorizontalIntrinsicsEstimator {
     public:
         static HorizontalIntrinsicsEstimation estimate(const PointArray &points, const VerticalIntrinsicsEstimation &vertical);
+        // Same estimation over points owned by the caller, whose horizontal fields are released once copied
+        static HorizontalIntrinsicsEstimation estimateReleasingFields(
+            PointArray &points, const VerticalIntrinsicsEstimation &vertical
+        );
+
+        static std::optional<ResolutionOffsetLoss> tryResolutionHint(
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx, int32_t hint
+        );
+
+        // Racing only discards candidates early, so the result must match the exhaustive evaluation
+        static std::optional<ResolutionOffsetLoss> findBestCandidateResolution(
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx, const std::vector<int32_t> &resolutions,
+            bool racing = BuildOptions::USE_HORIZONTAL_RESOLUTION_RACING
+        );
 
     private:
+        static HorizontalIntrinsicsEstimation estimate(
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlinesCount
+        );
+
+        static std::vector<std::optional<HorizontalScanline>> estimateScanlines(
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlinesCount
+        );
+
         static std::optional<HorizontalScanline> estimateScanline(
-            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx,
+            const std::vector<int32_t> &resolutionHints
         );
 
         static std::optional<ResolutionOffsetLoss> findOptimalHorizontalParameters(
-            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx
+            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx,
+            const std::vector<int32_t> &resolutionHints
+        );
+
+        static std::vector<int32_t> raceCandidateResolutions(
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+            const std::vector<int32_t> &resolutions
         );
 
+        static std::vector<std::optional<ResolutionOffsetLoss>> evaluateCandidateResolutions(
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+            const std::vector<int32_t> &resolutions
+        );
+
+        static bool isValidCandidate(const ResolutionOffsetLoss &candidate);
+
         static ResolutionOffsetLoss optimizeJointCandidateResolution(
-            const HorizontalScanlineArray &scanlineArray, int32_t scanlineIdx, int32_t resolution
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &invRangesXy,
+            int32_t resolution
         );
 
         static ResolutionOffsetLoss computeHeuristicValues(
-            const Eigen::ArrayXd &thetas, const Eigen::ArrayXd &ranges, int32_t resolution, double offset
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &ranges,
+            int32_t resolution, double offset
         );
 
         static void updateHeuristicScanlines(
@@ -53,7 +92,7 @@ namespace alice_lri {
         );
 
         static ResolutionOffsetLoss optimizeFromCandidatesHeuristic(
-            const Eigen::ArrayXd &thetas, const Eigen::ArrayXd &ranges,
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, const Eigen::Ref<const Eigen::ArrayXd> &ranges,
             const std::unordered_set<int32_t> &candidateResolutions, const std::unordered_set<double> &candidateOffsets
         );
 
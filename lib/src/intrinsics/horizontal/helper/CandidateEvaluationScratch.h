@@ -0,0 +1,24 @@
+#pragma once
+#include <Eigen/Core>
+
+namespace alice_lri {
+    // Buffers reused across the candidate resolutions of a scanline. They only grow, so evaluating a candidate does
+    // not allocate once they have been sized for the largest point set handled by the thread.
+    struct CandidateEvaluationScratch {
+        Eigen::ArrayXd diffToIdeal;
+        Eigen::ArrayXd diffToIdealReconstructed;
+        Eigen::ArrayXd residuals;
+        Eigen::ArrayXd shiftedY;
+
+        void reserve(const Eigen::Index size) {
+            if (diffToIdeal.size() >= size) {
+                return;
+            }
+
+            diffToIdeal.resize(size);
+            diffToIdealReconstructed.resize(size);
+            residuals.resize(size);
+            shiftedY.resize(size);
+        }
+    };
+}
@@ -1,26 +1,35 @@
 #include "HorizontalMath.h"
-#include <numeric>
+#include <cmath>
 #include <numbers>
-#include "utils/Utils.h"
 
 namespace alice_lri::HorizontalMath {
 
-    Eigen::ArrayXd computeDiffToIdeal(const Eigen::ArrayXd &thetas, const uint32_t resolution, const bool reconstruct) {
+    void computeDiffToIdeal(
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const uint32_t resolution,
+        Eigen::Ref<Eigen::ArrayXd> diffToIdeal, Eigen::Ref<Eigen::ArrayXd> diffToIdealReconstructed
+    ) {
         const double thetaStep = 2 * std::numbers::pi / static_cast<double>(resolution);
-        const auto closestIdeal = (thetas / thetaStep).round() * thetaStep;
-        Eigen::ArrayXd diffToIdeal = thetas - closestIdeal;
+        const double halfThetaStep = thetaStep / 2;
+        const Eigen::Index n = thetas.size();
+        if (n == 0) {
+            return;
+        }
 
-        if (reconstruct) {
-            const Eigen::ArrayXd diffDiffToIdeal = Utils::diff(diffToIdeal);
-            const auto jumpMask = (diffDiffToIdeal.abs() >= thetaStep / 2).cast<double>();
-            const auto signs = diffDiffToIdeal.sign().cast<double>();
-            const Eigen::ArrayXd diffDiffToIdealNoJumps = diffDiffToIdeal - thetaStep * jumpMask * signs;
+        diffToIdeal[0] = thetas[0] - std::round(thetas[0] / thetaStep) * thetaStep;
+        diffToIdealReconstructed[0] = 0;
 
-            // Diff to ideal is the cumulative sum of diffDiffToIdealNoJumps, with the first element being 0
-            diffToIdeal[0] = 0;
-            std::partial_sum(diffDiffToIdealNoJumps.begin(), diffDiffToIdealNoJumps.end(), diffToIdeal.begin() + 1);
-        }
+        // The reconstructed diff to ideal is the cumulative sum of the consecutive diffs with the jumps removed
+        double cumulative = 0;
+        for (Eigen::Index i = 1; i < n; ++i) {
+            diffToIdeal[i] = thetas[i] - std::round(thetas[i] / thetaStep) * thetaStep;
 
-        return diffToIdeal;
+            double diffDiff = diffToIdeal[i] - diffToIdeal[i - 1];
+            if (std::abs(diffDiff) >= halfThetaStep) {
+                diffDiff -= diffDiff > 0 ? thetaStep : -thetaStep;
+            }
+
+            cumulative += diffDiff;
+            diffToIdealReconstructed[i] = cumulative;
+        }
     }
 }
@@ -2,5 +2,8 @@
 #include <Eigen/Core>
 
 namespace alice_lri::HorizontalMath {
-    Eigen::ArrayXd computeDiffToIdeal(const Eigen::ArrayXd &thetas, uint32_t resolution, bool reconstruct);
+    void computeDiffToIdeal(
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, uint32_t resolution, Eigen::Ref<Eigen::ArrayXd> diffToIdeal,
+        Eigen::Ref<Eigen::ArrayXd> diffToIdealReconstructed
+    );
 }
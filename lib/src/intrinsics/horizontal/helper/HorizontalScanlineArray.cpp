@@ -1,84 +1,120 @@
 #include "HorizontalScanlineArray.h"
-#include "utils/Utils.h"
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+// Scanline slices start at multiples of this many values, so that reductions over them see the same alignment
+// as a standalone array
+constexpr int32_t SCANLINE_ALIGNMENT = std::max<int32_t>(EIGEN_MAX_ALIGN_BYTES / sizeof(double), 1);
 
 namespace alice_lri {
     HorizontalScanlineArray::HorizontalScanlineArray(
         const PointArray &points, const std::vector<int> &pointsScanlinesIds, const int32_t scanlinesCount,
         const SortingCriteria sortingCriteria
     ) {
-        auto pointsByScanline = groupPointsByScanline(pointsScanlinesIds, scanlinesCount);
+        std::vector<int32_t> groupOffsets;
+        std::vector<int32_t> pointIndices = groupPointsByScanline(pointsScanlinesIds, scanlinesCount, groupOffsets);
 
-        sortScanlinePointsByCriteria(points, sortingCriteria, pointsByScanline);
-        initScanlines(scanlinesCount);
-        populateScanlines(points, scanlinesCount, pointsByScanline);
+        sortScanlinePointsByCriteria(points, sortingCriteria, groupOffsets, pointIndices);
+        populateScanlines(points, groupOffsets, pointIndices);
     }
 
-    std::vector<std::vector<int32_t>> HorizontalScanlineArray::groupPointsByScanline(
-        const std::vector<int> &pointsScanlinesIds, const int32_t scanlinesCount
+    std::vector<int32_t> HorizontalScanlineArray::groupPointsByScanline(
+        const std::vector<int> &pointsScanlinesIds, const int32_t scanlinesCount, std::vector<int32_t> &groupOffsets
     ) {
-        std::vector<std::vector<int32_t>> pointsByScanline(scanlinesCount);
+        // Counting sort on the scanline id, keeping the original point order inside each scanline
+        scanlineSizes.assign(scanlinesCount, 0);
+        for (const int32_t scanlineIdx: pointsScanlinesIds) {
+            if (scanlineIdx >= 0) {
+                ++scanlineSizes[scanlineIdx];
+            }
+        }
 
-        for (int i = 0; i < pointsScanlinesIds.size(); ++i) {
+        groupOffsets.assign(scanlinesCount + 1, 0);
+        for (int32_t scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
+            groupOffsets[scanlineIdx + 1] = groupOffsets[scanlineIdx] + scanlineSizes[scanlineIdx];
+        }
+
+        std::vector<int32_t> pointIndices(groupOffsets[scanlinesCount]);
+        std::vector<int32_t> nextPosition(groupOffsets.begin(), groupOffsets.end() - 1);
+        for (int32_t i = 0; i < static_cast<int32_t>(pointsScanlinesIds.size()); ++i) {
             const int32_t scanlineIdx = pointsScanlinesIds[i];
 
             if (scanlineIdx >= 0) {
-                pointsByScanline[scanlineIdx].emplace_back(i);
+                pointIndices[nextPosition[scanlineIdx]++] = i;
             }
         }
 
-        return pointsByScanline;
+        return pointIndices;
     }
 
     void HorizontalScanlineArray::sortScanlinePointsByCriteria(
-        const PointArray &points, const SortingCriteria sortingCriteria,
-        std::vector<std::vector<int32_t>> &pointsByScanline
+        const PointArray &points, const SortingCriteria sortingCriteria, const std::vector<int32_t> &groupOffsets,
+        std::vector<int32_t> &pointIndices
     ) {
-        if (sortingCriteria == SortingCriteria::NONE) {
-            return;
-        }
-
-        auto comparator = [&](const int32_t a, const int32_t b) {
-            switch (sortingCriteria) {
-                case SortingCriteria::RANGES_XY:
-                    return points.getRangeXy(a) < points.getRangeXy(b);
-                case SortingCriteria::THETAS:
-                    return points.getTheta(a) < points.getTheta(b);
-                default:
-                    throw std::invalid_argument("Invalid sorting criteria");
+        switch (sortingCriteria) {
+            case SortingCriteria::RANGES_XY: {
+                const Eigen::ArrayXd &rangesXy = points.getRangesXy();
+                sortScanlinePoints(groupOffsets, pointIndices, [&](const int32_t i) { return rangesXy[i]; });
+                break;
             }
-        };
-
-        for (auto &scanline: pointsByScanline) {
-            std::ranges::sort(scanline, comparator);
+            case SortingCriteria::THETAS: {
+                const Eigen::ArrayXd &pointThetas = points.getThetas();
+                sortScanlinePoints(groupOffsets, pointIndices, [&](const int32_t i) { return pointThetas[i]; });
+                break;
+            }
+            case SortingCriteria::NONE:
+                break;
+            default:
+                throw std::invalid_argument("Invalid sorting criteria");
         }
     }
 
-    void HorizontalScanlineArray::initScanlines(const int32_t scanlinesCount) {
-        scanlineSizes.reserve(scanlinesCount);
-        xsByScanline.reserve(scanlinesCount);
-        ysByScanline.reserve(scanlinesCount);
-        rangesXyByScanline.reserve(scanlinesCount);
-        invRangesXyByScanline.reserve(scanlinesCount);
-        thetasByScanline.reserve(scanlinesCount);
+    template<typename Key>
+    void HorizontalScanlineArray::sortScanlinePoints(
+        const std::vector<int32_t> &groupOffsets, std::vector<int32_t> &pointIndices, const Key &key
+    ) {
+        const auto comparator = [&](const int32_t a, const int32_t b) {
+            return key(a) < key(b);
+        };
 
-        invRangesXyDiffByScanline.reserve(scanlinesCount);
+        for (size_t scanlineIdx = 0; scanlineIdx + 1 < groupOffsets.size(); ++scanlineIdx) {
+            const std::span segment(
+                pointIndices.begin() + groupOffsets[scanlineIdx], pointIndices.begin() + groupOffsets[scanlineIdx + 1]
+            );
+            std::ranges::sort(segment, comparator);
+        }
     }
 
     void HorizontalScanlineArray::populateScanlines(
-        const PointArray &points, const int32_t scanlinesCount,
-        const std::vector<std::vector<int32_t>> &pointsByScanline
+        const PointArray &points, const std::vector<int32_t> &groupOffsets, const std::vector<int32_t> &pointIndices
     ) {
-        for (int scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
-            const std::vector<int> &scanlineIndices = pointsByScanline[scanlineIdx];
+        const int32_t scanlinesCount = static_cast<int32_t>(scanlineSizes.size());
+        scanlineOffsets.resize(scanlinesCount);
 
-            scanlineSizes.emplace_back(static_cast<int32_t>(scanlineIndices.size()));
-            xsByScanline.emplace_back(points.getXs()(scanlineIndices));
-            ysByScanline.emplace_back(points.getYs()(scanlineIndices));
-            rangesXyByScanline.emplace_back(points.getRangesXy()(scanlineIndices));
-            invRangesXyByScanline.emplace_back(points.getInvRangesXy()(scanlineIndices));
-            thetasByScanline.emplace_back(points.getThetas()(scanlineIndices));
+        int32_t paddedSize = 0;
+        for (int32_t scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
+            scanlineOffsets[scanlineIdx] = paddedSize;
+            const int32_t alignedBlocks = (scanlineSizes[scanlineIdx] + SCANLINE_ALIGNMENT - 1) / SCANLINE_ALIGNMENT;
+            paddedSize += alignedBlocks * SCANLINE_ALIGNMENT;
+        }
+
+        rangesXy = Eigen::ArrayXd::Zero(paddedSize);
+        invRangesXy = Eigen::ArrayXd::Zero(paddedSize);
+        thetas = Eigen::ArrayXd::Zero(paddedSize);
 
-            invRangesXyDiffByScanline.emplace_back(Utils::diff(getInvRangesXy(scanlineIdx)));
+        const Eigen::ArrayXd &pointRangesXy = points.getRangesXy();
+        const Eigen::ArrayXd &pointInvRangesXy = points.getInvRangesXy();
+        const Eigen::ArrayXd &pointThetas = points.getThetas();
+
+        for (int32_t scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
+            const int32_t offset = scanlineOffsets[scanlineIdx];
+            for (int32_t i = 0; i < scanlineSizes[scanlineIdx]; ++i) {
+                const int32_t pointIdx = pointIndices[groupOffsets[scanlineIdx] + i];
+                rangesXy[offset + i] = pointRangesXy[pointIdx];
+                invRangesXy[offset + i] = pointInvRangesXy[pointIdx];
+                thetas[offset + i] = pointThetas[pointIdx];
+            }
         }
     }
 }
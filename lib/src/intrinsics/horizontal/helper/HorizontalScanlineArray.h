@@ -8,14 +8,12 @@ namespace alice_lri {
 
     class HorizontalScanlineArray {
     private:
+        // Points of each scanline are stored contiguously from its offset, which is padded to keep slices SIMD-aligned
+        std::vector<int32_t> scanlineOffsets;
         std::vector<int32_t> scanlineSizes;
-        std::vector<Eigen::ArrayXd> xsByScanline;
-        std::vector<Eigen::ArrayXd> ysByScanline;
-        std::vector<Eigen::ArrayXd> rangesXyByScanline;
-        std::vector<Eigen::ArrayXd> invRangesXyByScanline;
-        std::vector<Eigen::ArrayXd> thetasByScanline;
-
-        std::vector<Eigen::ArrayXd> invRangesXyDiffByScanline;
+        Eigen::ArrayXd rangesXy;
+        Eigen::ArrayXd invRangesXy;
+        Eigen::ArrayXd thetas;
 
     public:
         HorizontalScanlineArray(
@@ -23,48 +21,45 @@ namespace alice_lri {
             SortingCriteria sortingCriteria
         );
 
-        [[nodiscard]] const int32_t &getSize(const int32_t scanlineIdx) const {
+        [[nodiscard]] int32_t getSize(const int32_t scanlineIdx) const {
             return scanlineSizes[scanlineIdx];
         }
 
-        [[nodiscard]] const Eigen::ArrayXd &getXs(const int32_t scanlineIdx) const {
-            return xsByScanline[scanlineIdx];
-        }
-
-        [[nodiscard]] const Eigen::ArrayXd &getYs(const int32_t scanlineIdx) const {
-            return ysByScanline[scanlineIdx];
+        [[nodiscard]] Eigen::Map<const Eigen::ArrayXd> getRangesXy(const int32_t scanlineIdx) const {
+            return getScanlineSlice(rangesXy, scanlineIdx);
         }
 
-        [[nodiscard]] const Eigen::ArrayXd &getRangesXy(const int32_t scanlineIdx) const {
-            return rangesXyByScanline[scanlineIdx];
+        [[nodiscard]] Eigen::Map<const Eigen::ArrayXd> getInvRangesXy(const int32_t scanlineIdx) const {
+            return getScanlineSlice(invRangesXy, scanlineIdx);
         }
 
-        [[nodiscard]] const Eigen::ArrayXd &getInvRangesXy(const int32_t scanlineIdx) const {
-            return invRangesXyByScanline[scanlineIdx];
+        [[nodiscard]] Eigen::Map<const Eigen::ArrayXd> getThetas(const int32_t scanlineIdx) const {
+            return getScanlineSlice(thetas, scanlineIdx);
         }
 
-        [[nodiscard]] const Eigen::ArrayXd &getThetas(const int32_t scanlineIdx) const {
-            return thetasByScanline[scanlineIdx];
+    private:
+        [[nodiscard]] Eigen::Map<const Eigen::ArrayXd> getScanlineSlice(
+            const Eigen::ArrayXd &values, const int32_t scanlineIdx
+        ) const {
+            return {values.data() + scanlineOffsets[scanlineIdx], getSize(scanlineIdx)};
         }
 
-        [[nodiscard]] const Eigen::ArrayXd &getInvRangesXyDiff(const int32_t scanlineIdx) const {
-            return invRangesXyDiffByScanline[scanlineIdx];
-        }
+        std::vector<int32_t> groupPointsByScanline(
+            const std::vector<int> &pointsScanlinesIds, int32_t scanlinesCount, std::vector<int32_t> &groupOffsets
+        );
 
-    private:
         static void sortScanlinePointsByCriteria(
-            const PointArray &points, SortingCriteria sortingCriteria,
-            std::vector<std::vector<int32_t>> &pointsByScanline
+            const PointArray &points, SortingCriteria sortingCriteria, const std::vector<int32_t> &groupOffsets,
+            std::vector<int32_t> &pointIndices
         );
 
-        static std::vector<std::vector<int32_t>> groupPointsByScanline(
-            const std::vector<int> &pointsScanlinesIds, int32_t scanlinesCount
+        template<typename Key>
+        static void sortScanlinePoints(
+            const std::vector<int32_t> &groupOffsets, std::vector<int32_t> &pointIndices, const Key &key
         );
 
-        void initScanlines(int32_t scanlinesCount);
-
         void populateScanlines(
-            const PointArray &points, int32_t scanlinesCount, const std::vector<std::vector<int32_t>> &pointsByScanline
+            const PointArray &points, const std::vector<int32_t> &groupOffsets, const std::vector<int32_t> &pointIndices
         );
     };
 }
@@ -1,45 +1,70 @@
 #include "PeriodicFitter.h"
+#include <algorithm>
+#include <array>
 
 #include "Constants.h"
 #include "math/Trigonometry.h"
 
+constexpr Eigen::Index CIRCULAR_MEAN_BLOCK_SIZE = 256;
+
 namespace alice_lri {
 
     LRResult PeriodicFitter::fit(
-        const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, const double period, const double slopeGuess
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, const double period,
+        const double slopeGuess, Eigen::Ref<Eigen::ArrayXd> residuals, Eigen::Ref<Eigen::ArrayXd> shiftedY
     ) {
-        NewMultiLineResult multiLineResult;
-        computePeriodicResiduals(x, y, period, slopeGuess, 0, multiLineResult);
+        computePeriodicResiduals(x, y, period, slopeGuess, 0, residuals, shiftedY);
 
-        const double intercept = computeCircularMeanIntercept(multiLineResult.residuals, period);
-        computePeriodicResiduals(x, y, period, slopeGuess, intercept, multiLineResult);
+        const double intercept = computeCircularMeanIntercept(residuals, period);
+        computePeriodicResiduals(x, y, period, slopeGuess, intercept, residuals, shiftedY);
 
-        return refineFit(x, y, multiLineResult, period);
+        return refineFit(x, y, period, residuals, shiftedY);
     }
 
     void PeriodicFitter::computePeriodicResiduals(
-        const Eigen::ArrayXd& x, const Eigen::ArrayXd& y, const double period, const double slope,
-        const double intercept, NewMultiLineResult& outResult
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, const double period,
+        const double slope, const double intercept, Eigen::Ref<Eigen::ArrayXd> residuals,
+        Eigen::Ref<Eigen::ArrayXd> shiftedY
     ) {
-        outResult.residuals = y - (slope * x + intercept);
-        outResult.linesIdx = (outResult.residuals / period).round().cast<int>();
-        outResult.residuals = outResult.residuals - outResult.linesIdx.cast<double>() * period;
+        for (Eigen::Index i = 0; i < x.size(); ++i) {
+            const double residual = y[i] - (slope * x[i] + intercept);
+            const double lineOffset = static_cast<double>(static_cast<int>(std::round(residual / period))) * period;
+            residuals[i] = residual - lineOffset;
+            shiftedY[i] = y[i] - lineOffset;
+        }
     }
 
-    double PeriodicFitter::computeCircularMeanIntercept(const Eigen::ArrayXd& residuals, const double period) {
-        Eigen::ArrayXd residualsMod = residuals - period * (residuals / period).floor();
-        residualsMod *= Trigonometry::TRIG_TABLE_SIZE / period;
-        residualsMod = residualsMod.min(Trigonometry::TRIG_TABLE_SIZE - 1);
+    double PeriodicFitter::computeCircularMeanIntercept(
+        const Eigen::Ref<const Eigen::ArrayXd> &residuals, const double period
+    ) {
+        const double tableScale = Trigonometry::TRIG_TABLE_SIZE / period;
+        constexpr double maxTableIdx = Trigonometry::TRIG_TABLE_SIZE - 1;
+        const Trigonometry::SinCos *sinCosTable = Trigonometry::sinCosTable();
 
+        // Table indices are computed a block at a time, apart from the gathers, which are then summed in order
+        std::array<int32_t, CIRCULAR_MEAN_BLOCK_SIZE> indices{};
         double sinSum = 0.0, cosSum = 0.0;
-        for (const double residual : residualsMod) {
-            const int idx = static_cast<int>(residual);
-            sinSum += Trigonometry::sinIndex(idx);
-            cosSum += Trigonometry::cosIndex(idx);
+
+        for (Eigen::Index blockStart = 0; blockStart < residuals.size(); blockStart += CIRCULAR_MEAN_BLOCK_SIZE) {
+            const Eigen::Index blockSize = std::min<Eigen::Index>(
+                CIRCULAR_MEAN_BLOCK_SIZE, residuals.size() - blockStart
+            );
+
+            for (Eigen::Index i = 0; i < blockSize; ++i) {
+                const double residual = residuals[blockStart + i];
+                const double residualMod = (residual - period * std::floor(residual / period)) * tableScale;
+                indices[i] = static_cast<int32_t>(std::min(residualMod, maxTableIdx));
+            }
+
+            for (Eigen::Index i = 0; i < blockSize; ++i) {
+                const Trigonometry::SinCos &sinCos = sinCosTable[indices[i]];
+                sinSum += sinCos.sin;
+                cosSum += sinCos.cos;
+            }
         }
 
-        sinSum /= static_cast<double>(residualsMod.size());
-        cosSum /= static_cast<double>(residualsMod.size());
+        sinSum /= static_cast<double>(residuals.size());
+        cosSum /= static_cast<double>(residuals.size());
         double circularMean = std::atan2(sinSum, cosSum);
 
         if (circularMean < 0) {
@@ -50,18 +75,17 @@ namespace alice_lri {
     }
 
     LRResult PeriodicFitter::refineFit(
-        const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, NewMultiLineResult &multiLineResult, const double period
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, const double period,
+        Eigen::Ref<Eigen::ArrayXd> residuals, Eigen::Ref<Eigen::ArrayXd> shiftedY
     ) {
         const int32_t halfSize = static_cast<int32_t>(x.size()) / 2;
-        Eigen::ArrayXd shiftedY = y - multiLineResult.linesIdx.cast<double>() * period;
 
         const LRResult fitResultFirst = LinearRegressor::fit(x.head(halfSize), shiftedY.head(halfSize), true);
         const LRResult fitResultLast = LinearRegressor::fit(x.tail(halfSize), shiftedY.tail(halfSize), true);
         const LRResult fitResultAll = LinearRegressor::fit(x, shiftedY, true);
         const LRResult& optFit = (fitResultFirst.mse < fitResultLast.mse) ? fitResultFirst : fitResultLast;
 
-        computePeriodicResiduals(x, y, period, optFit.slope, optFit.intercept, multiLineResult);
-        shiftedY = y - multiLineResult.linesIdx.cast<double>() * period;
+        computePeriodicResiduals(x, y, period, optFit.slope, optFit.intercept, residuals, shiftedY);
         const LRResult fitResultFinal = LinearRegressor::fit(x, shiftedY, true);
 
         return fitResultAll.mse < fitResultFinal.mse ? fitResultAll : fitResultFinal;
@@ -6,23 +6,23 @@
 namespace alice_lri {
     class PeriodicFitter {
     public:
-        static LRResult fit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, double period, double slopeGuess);
+        // residuals and shiftedY are scratch buffers of the same size as x, overwritten in place
+        static LRResult fit(
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, double period,
+            double slopeGuess, Eigen::Ref<Eigen::ArrayXd> residuals, Eigen::Ref<Eigen::ArrayXd> shiftedY
+        );
 
     private:
-        struct NewMultiLineResult {
-            Eigen::ArrayXd residuals;
-            Eigen::ArrayXi linesIdx;
-        };
-
         static void computePeriodicResiduals(
-            const Eigen::ArrayXd& x, const Eigen::ArrayXd& y, double period, double slope,
-            double intercept, NewMultiLineResult& outResult
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, double period,
+            double slope, double intercept, Eigen::Ref<Eigen::ArrayXd> residuals, Eigen::Ref<Eigen::ArrayXd> shiftedY
         );
 
-        static double computeCircularMeanIntercept(const Eigen::ArrayXd& residuals, double period);
+        static double computeCircularMeanIntercept(const Eigen::Ref<const Eigen::ArrayXd> &residuals, double period);
 
         static LRResult refineFit(
-            const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, NewMultiLineResult &multiLineResult, double period
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, double period,
+            Eigen::Ref<Eigen::ArrayXd> residuals, Eigen::Ref<Eigen::ArrayXd> shiftedY
         );
     };
 }
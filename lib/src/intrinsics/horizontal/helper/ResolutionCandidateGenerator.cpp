@@ -0,0 +1,158 @@
+#include "ResolutionCandidateGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include "Constants.h"
+
+constexpr uint64_t MIN_GAPS = 32;
+constexpr double INITIAL_GAP_QUANTILE = 0.25;
+constexpr int32_t FIT_ITERATIONS = 3;
+constexpr int32_t MAX_GAP_STEPS = 16;
+constexpr double GAP_TOLERANCE = 0.2;
+constexpr double MIN_INLIER_FRACTION = 0.5;
+constexpr double COARSEN_INLIER_RATIO = 0.9;
+constexpr int32_t MAX_STEP_MULTIPLE = 8;
+constexpr double WINDOW_SIGMAS = 4;
+constexpr int32_t MIN_WINDOW = 2;
+constexpr int32_t MAX_WINDOW = 64;
+
+namespace alice_lri {
+    std::optional<std::vector<int32_t>> ResolutionCandidateGenerator::generate(
+        const Eigen::Ref<const Eigen::ArrayXd> &thetas, const int32_t minResolution
+    ) {
+        std::vector<double> gaps = computeSortedGaps(thetas);
+        if (gaps.size() < MIN_GAPS) {
+            return std::nullopt;
+        }
+
+        const double initialStep = gaps[static_cast<size_t>(INITIAL_GAP_QUANTILE * static_cast<double>(gaps.size()))];
+        const std::optional<GapFit> initialFit = fitStep(gaps, initialStep);
+        if (!initialFit || initialFit->inlierFraction < MIN_INLIER_FRACTION) {
+            return std::nullopt;
+        }
+
+        // The fitted step might be a fraction of the true one if the initial guess was too small, but the true step
+        // might also be a fraction of the fitted one if the scanline is sparse. Coarsening handles the former, while
+        // the latter is covered by proposing multiples of the base resolution.
+        const std::optional<GapFit> fit = coarsenStep(gaps, *initialFit);
+        if (!fit) {
+            return std::nullopt;
+        }
+
+        std::vector<int32_t> candidates;
+        for (int32_t multiple = 1; multiple <= MAX_STEP_MULTIPLE; ++multiple) {
+            const double resolution = multiple * Constant::TWO_PI / fit->step;
+            const double resolutionError = resolution * fit->stepError / fit->step;
+            const double window = std::ceil(WINDOW_SIGMAS * resolutionError);
+
+            if (window > MAX_WINDOW) {
+                return std::nullopt;
+            }
+
+            const auto center = static_cast<int32_t>(std::round(resolution));
+            const int32_t halfWidth = std::max(static_cast<int32_t>(window), MIN_WINDOW);
+            const int32_t lower = std::max(center - halfWidth, minResolution);
+            const int32_t upper = std::min(center + halfWidth, Constant::MAX_RESOLUTION);
+
+            for (int32_t candidate = lower; candidate <= upper; ++candidate) {
+                candidates.emplace_back(candidate);
+            }
+        }
+
+        std::ranges::sort(candidates);
+        const auto duplicates = std::ranges::unique(candidates);
+        candidates.erase(duplicates.begin(), duplicates.end());
+
+        if (candidates.empty()) {
+            return std::nullopt;
+        }
+
+        return candidates;
+    }
+
+    std::vector<double> ResolutionCandidateGenerator::computeSortedGaps(const Eigen::Ref<const Eigen::ArrayXd> &thetas) {
+        std::vector<double> sortedThetas(thetas.begin(), thetas.end());
+        std::ranges::sort(sortedThetas);
+
+        std::vector<double> gaps;
+        gaps.reserve(sortedThetas.size());
+
+        for (size_t i = 1; i < sortedThetas.size(); ++i) {
+            const double gap = sortedThetas[i] - sortedThetas[i - 1];
+
+            if (gap > 0) {
+                gaps.emplace_back(gap);
+            }
+        }
+
+        std::ranges::sort(gaps);
+        return gaps;
+    }
+
+    std::optional<ResolutionCandidateGenerator::GapFit> ResolutionCandidateGenerator::fitStep(
+        const std::vector<double> &gaps, const double initialStep
+    ) {
+        double step = initialStep;
+
+        for (int32_t iteration = 0; iteration < FIT_ITERATIONS; ++iteration) {
+            double sumGapsSteps = 0, sumStepsSquared = 0;
+            uint64_t inliers = 0;
+
+            for (const double gap : gaps) {
+                const double steps = std::round(gap / step);
+
+                if (steps >= 1 && steps <= MAX_GAP_STEPS && std::abs(gap / step - steps) < GAP_TOLERANCE) {
+                    sumGapsSteps += gap * steps;
+                    sumStepsSquared += steps * steps;
+                    inliers++;
+                }
+            }
+
+            if (inliers < 2) {
+                return std::nullopt;
+            }
+
+            step = sumGapsSteps / sumStepsSquared;
+        }
+
+        // The final step may select other inliers than the step it was fitted from, so its error and inlier fraction
+        // are measured on its own inlier set
+        double sumResidualsSquared = 0, sumStepsSquared = 0;
+        uint64_t inliers = 0;
+
+        for (const double gap : gaps) {
+            const double steps = std::round(gap / step);
+
+            if (steps >= 1 && steps <= MAX_GAP_STEPS && std::abs(gap / step - steps) < GAP_TOLERANCE) {
+                sumResidualsSquared += (gap - steps * step) * (gap - steps * step);
+                sumStepsSquared += steps * steps;
+                inliers++;
+            }
+        }
+
+        if (inliers < 2) {
+            return std::nullopt;
+        }
+
+        const double residualsVariance = sumResidualsSquared / static_cast<double>(inliers - 1);
+
+        return GapFit {
+            .step = step,
+            .stepError = std::sqrt(residualsVariance / sumStepsSquared),
+            .inlierFraction = static_cast<double>(inliers) / static_cast<double>(gaps.size())
+        };
+    }
+
+    std::optional<ResolutionCandidateGenerator::GapFit> ResolutionCandidateGenerator::coarsenStep(
+        const std::vector<double> &gaps, const GapFit &fit
+    ) {
+        for (int32_t factor = MAX_STEP_MULTIPLE; factor > 1; --factor) {
+            const std::optional<GapFit> coarseFit = fitStep(gaps, fit.step * factor);
+
+            if (coarseFit && coarseFit->inlierFraction >= COARSEN_INLIER_RATIO * fit.inlierFraction) {
+                return coarseFit;
+            }
+        }
+
+        return fit;
+    }
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include <optional>
+#include <vector>
+#include <Eigen/Core>
+
+namespace alice_lri {
+    class ResolutionCandidateGenerator {
+    private:
+        struct GapFit {
+            double step;
+            double stepError;
+            double inlierFraction;
+        };
+
+    public:
+        static std::optional<std::vector<int32_t>> generate(
+            const Eigen::Ref<const Eigen::ArrayXd> &thetas, int32_t minResolution
+        );
+
+    private:
+        static std::vector<double> computeSortedGaps(const Eigen::Ref<const Eigen::ArrayXd> &thetas);
+
+        static std::optional<GapFit> fitStep(const std::vector<double> &gaps, double initialStep);
+
+        static std::optional<GapFit> coarsenStep(const std::vector<double> &gaps, const GapFit &fit);
+    };
+}
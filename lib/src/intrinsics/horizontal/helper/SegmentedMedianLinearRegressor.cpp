@@ -1,58 +1,65 @@
 #include "SegmentedMedianLinearRegressor.h"
 
-#include "intrinsics/horizontal/helper/HorizontalMath.h"
 #include "math/Stats.h"
 #include "utils/logger/Logger.h"
 #include "utils/Utils.h"
 
 namespace alice_lri {
-    LRResult SegmentedMedianLinearRegressor::fit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y) const {
-        const Segments segments = segmentAndFit(x, y);
+    LRResult SegmentedMedianLinearRegressor::fit(
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y
+    ) const {
+        // Reused across calls so that fitting a candidate resolution does not allocate
+        thread_local Segments segments;
+        segments.clear();
+        segmentAndFit(x, y, segments);
 
         if (segments.count() == 0) {
             return LRResult(0,0);
         }
 
+        // The weighted median reorders its inputs, so each one gets its own copy of the weights
+        segments.medianWeights.assign(segments.weights.begin(), segments.weights.end());
+
         return LRResult(
-            Stats::weightedMedian(segments.slopes, segments.weights),
+            Stats::weightedMedian(segments.slopes, segments.medianWeights),
             Stats::weightedMedian(segments.intercepts, segments.weights),
             std::nullopt
         );
     }
 
-    SegmentedMedianLinearRegressor::Segments SegmentedMedianLinearRegressor::segmentAndFit(
-        const Eigen::ArrayXd &x, const Eigen::ArrayXd &y
+    void SegmentedMedianLinearRegressor::segmentAndFit(
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, Segments &segments
     ) const {
-        Segments segments;
         const int32_t n = static_cast<int32_t>(x.size());
-        const Eigen::ArrayX<bool> continuityMask =
-                (Utils::diff(x).abs() < segmentThresholdX) && (Utils::diff(y).abs() < segmentThresholdY);
 
+        // Segments span [blockStart + 1, i), accumulating their sums while scanning for discontinuities
+        LRSums sums;
         int blockStart = 0;
         for (int i = 1; i < n; ++i) {
-            if (!continuityMask[i - 1]) {
-                processSegment(x, y, blockStart + 1, i, segments);
+            const bool continuous =
+                    std::abs(x[i] - x[i - 1]) < segmentThresholdX && std::abs(y[i] - y[i - 1]) < segmentThresholdY;
+
+            if (!continuous) {
+                processSegment(sums, blockStart + 1, i, segments);
+                sums = LRSums();
                 blockStart = i;
+            } else {
+                sums.add(x[i], y[i]);
             }
         }
 
-        processSegment(x, y, blockStart + 1, n, segments);
-        return segments;
+        processSegment(sums, blockStart + 1, n, segments);
     }
 
     void SegmentedMedianLinearRegressor::processSegment(
-        const Eigen::ArrayXd& x, const Eigen::ArrayXd& y, const int32_t startIdx, const int32_t endIdx,
-        Segments& slopeWeights
+        const LRSums &sums, const int32_t startIdx, const int32_t endIdx, Segments& slopeWeights
     ) const {
         const int size = endIdx - startIdx;
         if (size <= 2) {
             return;
         }
 
-        const Eigen::Map<const Eigen::ArrayXd> fitX(x.data() + startIdx, size);
-        const Eigen::Map<const Eigen::ArrayXd> fitY(y.data() + startIdx, size);
-
-        const auto lrResult = LinearRegressor::fit(fitX, fitY, false);
+        const auto lrResult = LinearRegressor::fit(sums);
         const double slope = lrResult.slope;
         const double intercept = Utils::positiveFmod(lrResult.intercept, interceptMod);
 
@@ -64,9 +71,10 @@ namespace alice_lri {
         LOG_DEBUG("Using slope ", slope, " and intercept ", intercept, " for block [", startIdx, ", ", endIdx, ") with size ", size);
     }
 
-    void SegmentedMedianLinearRegressor::Segments::reserve(const uint64_t count) {
-        slopes.reserve(count);
-        weights.reserve(count);
+    void SegmentedMedianLinearRegressor::Segments::clear() {
+        slopes.clear();
+        intercepts.clear();
+        weights.clear();
     }
 
     void SegmentedMedianLinearRegressor::Segments::append(
@@ -11,8 +11,9 @@ namespace alice_lri {
             std::vector<double> slopes;
             std::vector<double> intercepts;
             std::vector<int32_t> weights;
+            std::vector<int32_t> medianWeights;
 
-            void reserve(uint64_t count);
+            void clear();
 
             void append(double slope, double intercept, int32_t weight);
 
@@ -33,14 +34,15 @@ namespace alice_lri {
             maxSlope(maxSlope),
             interceptMod(interceptMod) {}
 
-        [[nodiscard]] LRResult fit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y) const;
+        [[nodiscard]] LRResult fit(
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y
+        ) const;
 
     private:
-        void processSegment(
-            const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, int32_t startIdx, int32_t endIdx,
-            Segments &slopeWeights
-        ) const;
+        void processSegment(const LRSums &sums, int32_t startIdx, int32_t endIdx, Segments &slopeWeights) const;
 
-        [[nodiscard]] Segments segmentAndFit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y) const;
+        void segmentAndFit(
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, Segments &segments
+        ) const;
     };
 }
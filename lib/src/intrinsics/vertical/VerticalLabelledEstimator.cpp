@@ -0,0 +1,162 @@
+#include "VerticalLabelledEstimator.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include "Constants.h"
+#include "intrinsics/vertical/estimation/VerticalScanlineLimits.h"
+#include "math/LinearRegressor.h"
+#include "utils/logger/Logger.h"
+#include "utils/Timer.h"
+
+namespace alice_lri {
+    std::optional<VerticalIntrinsicsEstimation> VerticalLabelledEstimator::estimate(
+        const PointArray &points, const Eigen::ArrayXi &labels
+    ) {
+        PROFILE_SCOPE("VerticalLabelledEstimator::estimate");
+        const auto groups = groupByLabel(labels);
+        if (!groups) {
+            LOG_WARN("Warning: Scanline labels must not be negative");
+            return std::nullopt;
+        }
+
+        std::vector<VerticalScanlineEstimation> estimations;
+        estimations.reserve(groups->size());
+
+        for (const Eigen::ArrayXi &indices: *groups) {
+            auto estimation = fitGroup(points, indices);
+            if (!estimation) {
+                return std::nullopt;
+            }
+
+            estimations.emplace_back(std::move(*estimation));
+        }
+
+        // Scanlines are identified by increasing angle, as in the full search
+        std::vector<uint32_t> order(estimations.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::sort(order, [&](const uint32_t a, const uint32_t b) {
+            return estimations[a].angle.value < estimations[b].angle.value;
+        });
+
+        VerticalScanlinesAssignations assignations;
+        assignations.pointsScanlinesIds.resize(points.size());
+
+        for (uint32_t id = 0; id < order.size(); ++id) {
+            const VerticalScanlineEstimation &estimation = estimations[order[id]];
+
+            if (id > 0 && estimation.angle.value <= assignations.scanlines.back().angle.value) {
+                LOG_WARN("Warning: Two scanline labels describe the same scanline");
+                return std::nullopt;
+            }
+
+            for (const int32_t pointIdx: estimation.limits.indices) {
+                assignations.pointsScanlinesIds[pointIdx] = static_cast<int>(id);
+            }
+
+            assignations.scanlines.emplace_back(VerticalScanline{
+                .id = id,
+                .pointsCount = static_cast<uint64_t>(estimation.limits.indices.size()),
+                .angle = estimation.angle,
+                .offset = estimation.offset,
+                .theoreticalAngleBounds = estimation.toAngleBounds(points.getMinRange(), points.getMaxRange()),
+                .uncertainty = estimation.uncertainty,
+                .heuristic = false,
+                .hough = {.cell = {}, .margin = {.offset = Constant::OFFSET_STEP, .angle = Constant::ANGLE_STEP}},
+            });
+        }
+
+        LOG_INFO("Number of scanlines from labels: ", assignations.scanlines.size());
+
+        return VerticalIntrinsicsEstimation{
+            .iterations = 0,
+            .unassignedPoints = 0,
+            .pointsCount = static_cast<int32_t>(points.size()),
+            .endReason = EndReason::ALL_ASSIGNED,
+            .scanlinesAssignations = std::move(assignations)
+        };
+    }
+
+    std::optional<std::vector<Eigen::ArrayXi>> VerticalLabelledEstimator::groupByLabel(const Eigen::ArrayXi &labels) {
+        if (labels.size() == 0 || labels.minCoeff() < 0) {
+            return std::nullopt;
+        }
+
+        // Point indices sorted by label, so that each label is a run. Labels are driver IDs that may be sparse or
+        // larger than the number of points, e.g. on a subsample, so they are not used to index a table
+        std::vector<int32_t> order(labels.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::stable_sort(order, [&](const int32_t a, const int32_t b) { return labels[a] < labels[b]; });
+
+        std::vector<Eigen::ArrayXi> groups;
+        for (size_t begin = 0; begin < order.size();) {
+            size_t end = begin + 1;
+            while (end < order.size() && labels[order[end]] == labels[order[begin]]) {
+                ++end;
+            }
+
+            groups.emplace_back(Eigen::Map<const Eigen::ArrayXi>(
+                order.data() + begin, static_cast<Eigen::Index>(end - begin)
+            ));
+            begin = end;
+        }
+
+        return groups;
+    }
+
+    std::optional<VerticalScanlineEstimation> VerticalLabelledEstimator::fitGroup(
+        const PointArray &points, const Eigen::ArrayXi &indices
+    ) {
+        if (indices.size() <= 2) {
+            LOG_WARN("Warning: Scanline label with only ", indices.size(), " points");
+            return std::nullopt;
+        }
+
+        const PointArray group = points.select(indices);
+        VerticalBounds errorBounds;
+        WLSResult fit{};
+        double offset = 0;
+
+        // The error bounds depend on the offset, so the fit is repeated until the offset settles
+        for (uint64_t attempt = 0; attempt < Constant::VERTICAL_MAX_FIT_ATTEMPTS; ++attempt) {
+            errorBounds = VerticalScanlineLimits::computeErrorBounds(group, offset);
+            fit = LinearRegressor::wlsBoundsFit(group.getInvRanges(), group.getPhis(), errorBounds.final);
+
+            const bool settled = std::abs(fit.slope - offset) <= Constant::OFFSET_STEP * 1e-3;
+            offset = fit.slope;
+            if (settled) {
+                break;
+            }
+        }
+
+        const double offsetCiWidth = fit.slopeCi(1) - fit.slopeCi(0);
+        if (!std::isfinite(fit.slope) || !std::isfinite(fit.intercept) ||
+            offsetCiWidth > Constant::VERTICAL_MAX_OFFSET_CI_WIDTH) {
+            LOG_WARN("Warning: Scanline label does not fit a single scanline, CI width: ", offsetCiWidth);
+            return std::nullopt;
+        }
+
+        // Every labelled point must be explained by the fitted scanline
+        const VerticalMargin margin = {.offset = Constant::OFFSET_STEP, .angle = Constant::ANGLE_STEP};
+        const ScanlineLimits limits = VerticalScanlineLimits::computeScanlineLimits(
+            group, errorBounds.final, fit.slope, fit.intercept, margin
+        );
+
+        if (limits.indices.size() != indices.size()) {
+            LOG_WARN("Warning: ", indices.size() - limits.indices.size(), " points lie outside their labelled scanline");
+            return std::nullopt;
+        }
+
+        ValueConfInterval offsetInterval = {
+            .value = fit.slope, .ci = {.lower = fit.slopeCi[0], .upper = fit.slopeCi[1]}
+        };
+        offsetInterval.ci.clampBoth(-points.getMinRange(), points.getMinRange());
+
+        return VerticalScanlineEstimation{
+            .heuristic = false,
+            .uncertainty = -fit.logLikelihood,
+            .offset = offsetInterval,
+            .angle = {.value = fit.intercept, .ci = {.lower = fit.interceptCi[0], .upper = fit.interceptCi[1]}},
+            .limits = {.indices = indices, .mask = Eigen::ArrayX<bool>()}
+        };
+    }
+}
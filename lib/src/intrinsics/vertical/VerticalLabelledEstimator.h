@@ -0,0 +1,26 @@
+#pragma once
+#include <optional>
+#include <vector>
+#include <Eigen/Core>
+#include "intrinsics/vertical/VerticalIntrinsicsStructs.h"
+#include "intrinsics/vertical/estimation/VerticalScanlineEstimationStructs.h"
+#include "point/PointArray.h"
+
+namespace alice_lri {
+    // Vertical stage for point clouds whose points come labelled with their scanline, e.g. the ring index provided by
+    // many drivers. Each labelled group is fitted once, without the Hough search
+    class VerticalLabelledEstimator {
+    public:
+        // Empty if the labels do not describe valid scanlines, in which case the full search must be used
+        static std::optional<VerticalIntrinsicsEstimation> estimate(
+            const PointArray &points, const Eigen::ArrayXi &labels
+        );
+
+    private:
+        static std::optional<std::vector<Eigen::ArrayXi>> groupByLabel(const Eigen::ArrayXi &labels);
+
+        static std::optional<VerticalScanlineEstimation> fitGroup(
+            const PointArray &points, const Eigen::ArrayXi &indices
+        );
+    };
+}
@@ -3,6 +3,7 @@
 #include "intrinsics/vertical/estimation/VerticalScanlineEstimationStructs.h"
 #include "intrinsics/vertical/estimation/VerticalScanlineLimits.h"
 #include "intrinsics/vertical/pool/VerticalScanlinePool.h"
+#include "math/FastMath.h"
 #include "point/PointArray.h"
 #include "utils/logger/Logger.h"
 
@@ -143,10 +144,16 @@ namespace alice_lri {
     ValueConfInterval VerticalHeuristicsEstimator::computeHeuristicAngle(
         const Eigen::ArrayXd &invRanges, const Eigen::ArrayXd &phis, const ValueConfInterval &offset
     ) {
-        const double heuristicAngle = (phis - (offset.value * invRanges).asin()).mean();
+        const auto meanAngle = [&](const double verticalOffset) {
+            Eigen::ArrayXd correction = verticalOffset * invRanges;
+            FastMath::asin(correction, correction);
+            return (phis - correction).mean();
+        };
+
+        const double heuristicAngle = meanAngle(offset.value);
         const Interval angleInterval = {
-            .lower = (phis - (offset.ci.lower * invRanges).asin()).mean(),
-            .upper = (phis - (offset.ci.upper * invRanges).asin()).mean()
+            .lower = meanAngle(offset.ci.lower),
+            .upper = meanAngle(offset.ci.upper)
         };
 
         const Interval heuristicAngleCi = {
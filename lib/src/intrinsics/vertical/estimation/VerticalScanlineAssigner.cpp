@@ -0,0 +1,92 @@
+#include "VerticalScanlineAssigner.h"
+#include <algorithm>
+#include <cmath>
+#include "utils/Timer.h"
+
+constexpr Eigen::Index ASSIGNMENT_BLOCK_SIZE = 4096;
+
+namespace alice_lri {
+
+    namespace {
+        bool isWithinScanlineLimits(const PointArray &points, const Eigen::Index index, const VerticalScanline &scanline) {
+            const double coordsEps = points.getCoordsEps();
+            const double rangesBound = coordsEps * std::sqrt(3);
+            const double rangesXyBound = coordsEps * std::sqrt(2);
+
+            const double range = points.getRange(index);
+            const double rangeXy = points.getRangeXy(index);
+            const double invRange = points.getInvRange(index);
+            const double phi = points.getPhi(index);
+
+            const double offset = scanline.offset.value;
+            const double angle = scanline.angle.value;
+            const VerticalMargin &margin = scanline.hough.margin;
+
+            const double phiBound = (rangesXyBound * std::abs(points.getZ(index)) + coordsEps * rangeXy) /
+                (rangeXy * rangeXy - rangesXyBound * rangeXy);
+            const double correctionBound = std::abs(offset) * rangesBound / (range * range - rangesBound * range);
+            const double errorBound = phiBound + correctionBound;
+
+            const double sinUpper = std::asin(std::clamp((offset + margin.offset) * invRange, -1.0, 1.0));
+            const double sinLower = std::asin(std::clamp((offset - margin.offset) * invRange, -1.0, 1.0));
+
+            const double upper = angle + sinUpper + margin.angle + errorBound;
+            const double lower = angle + sinLower - margin.angle - errorBound;
+
+            return lower <= phi && phi <= upper;
+        }
+    }
+
+    void VerticalScanlineAssigner::assignAllPoints(const PointArray &points, VerticalIntrinsicsEstimation &estimation) {
+        PROFILE_SCOPE("VerticalScanlineAssigner::assignAllPoints");
+        std::vector<VerticalScanline> &scanlines = estimation.scanlinesAssignations.scanlines;
+        const auto pointsCount = static_cast<Eigen::Index>(points.size());
+
+        std::vector<int> pointsScanlinesIds(pointsCount, -1);
+        int64_t unassignedPoints = 0;
+
+        for (VerticalScanline &scanline : scanlines) {
+            scanline.pointsCount = 0;
+        }
+
+        Eigen::ArrayXd bestDistance, distance;
+        Eigen::ArrayXi bestScanline;
+        Eigen::ArrayX<bool> closer;
+
+        for (Eigen::Index start = 0; start < pointsCount; start += ASSIGNMENT_BLOCK_SIZE) {
+            const Eigen::Index blockSize = std::min(ASSIGNMENT_BLOCK_SIZE, pointsCount - start);
+            const auto phis = points.getPhis().segment(start, blockSize);
+            const auto invRanges = points.getInvRanges().segment(start, blockSize);
+
+            bestDistance.setConstant(blockSize, std::numeric_limits<double>::infinity());
+            bestScanline.setConstant(blockSize, -1);
+
+            for (int s = 0; s < static_cast<int>(scanlines.size()); ++s) {
+                const double offset = scanlines[s].offset.value;
+                const double angle = scanlines[s].angle.value;
+
+                distance = (phis - angle - (offset * invRanges).min(1).max(-1).asin()).abs();
+                closer = distance < bestDistance;
+                bestScanline = closer.select(s, bestScanline);
+                bestDistance = closer.select(distance, bestDistance);
+            }
+
+            for (Eigen::Index j = 0; j < blockSize; ++j) {
+                const Eigen::Index index = start + j;
+                const int scanlineIdx = bestScanline[j];
+
+                if (scanlineIdx < 0 || !isWithinScanlineLimits(points, index, scanlines[scanlineIdx])) {
+                    unassignedPoints++;
+                    continue;
+                }
+
+                pointsScanlinesIds[index] = scanlineIdx;
+                scanlines[scanlineIdx].pointsCount++;
+            }
+        }
+
+        estimation.scanlinesAssignations.pointsScanlinesIds = std::move(pointsScanlinesIds);
+        estimation.unassignedPoints = static_cast<int32_t>(unassignedPoints);
+        estimation.pointsCount = static_cast<int32_t>(pointsCount);
+    }
+}
@@ -0,0 +1,9 @@
+#pragma once
+#include "intrinsics/vertical/VerticalIntrinsicsStructs.h"
+#include "point/PointArray.h"
+
+namespace alice_lri::VerticalScanlineAssigner {
+
+    void assignAllPoints(const PointArray &points, VerticalIntrinsicsEstimation &estimation);
+
+}
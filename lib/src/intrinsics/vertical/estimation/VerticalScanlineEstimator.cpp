@@ -126,7 +126,7 @@ namespace alice_lri {
 
     bool VerticalScanlineEstimator::verifyConfidenceIntervals(const WLSResult &fitResult) {
         double offsetCiWidth = fitResult.slopeCi(1) - fitResult.slopeCi(0);
-        if (offsetCiWidth > 1e-2) {
+        if (offsetCiWidth > Constant::VERTICAL_MAX_OFFSET_CI_WIDTH) {
             ciTooWideState++;
 
             if (ciTooWideState >= 2) {
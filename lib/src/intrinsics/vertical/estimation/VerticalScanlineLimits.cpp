@@ -1,4 +1,5 @@
 #include "VerticalScanlineLimits.h"
+#include "math/FastMath.h"
 #include "point/PointArray.h"
 #include "utils/Timer.h"
 #include "utils/Utils.h"
@@ -40,8 +41,10 @@ namespace alice_lri {
         const auto &inv = points.getInvRanges();
         const auto &phi = points.getPhis();
 
-        const auto sinUpper = ((offset + margin.offset) * inv.array()).min(1).max(-1).asin();
-        const auto sinLower = ((offset - margin.offset) * inv.array()).min(1).max(-1).asin();
+        Eigen::ArrayXd sinUpper = ((offset + margin.offset) * inv.array()).min(1).max(-1);
+        Eigen::ArrayXd sinLower = ((offset - margin.offset) * inv.array()).min(1).max(-1);
+        FastMath::asin(sinUpper, sinUpper);
+        FastMath::asin(sinLower, sinLower);
 
         const Eigen::ArrayXd upper = angle + sinUpper + margin.angle + errorBounds.array();
         const Eigen::ArrayXd lower = angle + sinLower - margin.angle - errorBounds.array();
@@ -0,0 +1,278 @@
+#include "PointFileLayout.h"
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+constexpr uint64_t KITTI_RECORD_SIZE = 4 * sizeof(float);
+
+namespace alice_lri {
+    namespace {
+        struct PointField {
+            std::string name;
+            uint64_t size = 0;
+            uint64_t count = 1;
+            bool isFloat = false;
+        };
+
+        // Reads the next header line, without its line terminator, and advances past it
+        std::optional<std::string_view> nextLine(const std::string_view contents, uint64_t &position) {
+            const uint64_t end = contents.find('\n', position);
+            if (end == std::string_view::npos) {
+                return std::nullopt;
+            }
+
+            std::string_view line = contents.substr(position, end - position);
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+
+            position = end + 1;
+            return line;
+        }
+
+        std::vector<std::string> tokenize(const std::string_view line) {
+            std::istringstream stream{std::string(line)};
+            std::vector<std::string> tokens;
+            for (std::string token; stream >> token;) {
+                tokens.emplace_back(std::move(token));
+            }
+            return tokens;
+        }
+
+        std::optional<uint64_t> toUnsigned(const std::string &token) {
+            try {
+                size_t parsed = 0;
+                const uint64_t value = std::stoull(token, &parsed);
+                return parsed == token.size() ? std::make_optional(value) : std::nullopt;
+            } catch (const std::exception &) {
+                return std::nullopt;
+            }
+        }
+
+        // Byte size of a PLY scalar type, or 0 if unknown
+        uint64_t plyTypeSize(const std::string &type) {
+            if (type == "char" || type == "uchar" || type == "int8" || type == "uint8") {
+                return 1;
+            }
+            if (type == "short" || type == "ushort" || type == "int16" || type == "uint16") {
+                return 2;
+            }
+            if (type == "int" || type == "uint" || type == "float" || type == "int32" || type == "uint32" ||
+                type == "float32") {
+                return 4;
+            }
+            if (type == "double" || type == "float64") {
+                return 8;
+            }
+            return 0;
+        }
+
+        // Lays the fields out one after the other and checks that x, y and z are single float32 values that fit. Sizes
+        // come from untrusted headers, so any layout whose stride does not fit in 64 bits is rejected
+        std::optional<PointFileLayout> buildLayout(
+            const std::vector<PointField> &fields, const uint64_t dataOffset, const uint64_t pointsCount,
+            const uint64_t contentsSize
+        ) {
+            PointFileLayout layout{.dataOffset = dataOffset, .pointsCount = pointsCount};
+            std::optional<uint64_t> x, y, z;
+
+            for (const PointField &field: fields) {
+                if (field.name == "x" || field.name == "y" || field.name == "z") {
+                    if (!field.isFloat || field.size != sizeof(float) || field.count != 1) {
+                        return std::nullopt;
+                    }
+                    (field.name == "x" ? x : field.name == "y" ? y : z) = layout.stride;
+                }
+
+                constexpr uint64_t maxSize = std::numeric_limits<uint64_t>::max();
+                if (field.count != 0 && field.size > maxSize / field.count) {
+                    return std::nullopt;
+                }
+
+                const uint64_t fieldSize = field.size * field.count;
+                if (fieldSize > maxSize - layout.stride) {
+                    return std::nullopt;
+                }
+                layout.stride += fieldSize;
+            }
+
+            if (!x || !y || !z || layout.stride == 0) {
+                return std::nullopt;
+            }
+
+            for (const uint64_t offset: {*x, *y, *z}) {
+                if (offset > layout.stride - sizeof(float)) {
+                    return std::nullopt;
+                }
+            }
+
+            if (dataOffset > contentsSize || (contentsSize - dataOffset) / layout.stride < pointsCount) {
+                return std::nullopt;
+            }
+
+            layout.xOffset = *x;
+            layout.yOffset = *y;
+            layout.zOffset = *z;
+            return layout;
+        }
+    }
+
+    PointFileFormat PointFileLayoutParser::detectFormat(const std::string_view path) {
+        const uint64_t dot = path.rfind('.');
+        if (dot == std::string_view::npos) {
+            return PointFileFormat::AUTO;
+        }
+
+        std::string extension(path.substr(dot + 1));
+        std::ranges::transform(extension, extension.begin(), [](const unsigned char c) { return std::tolower(c); });
+
+        if (extension == "bin") {
+            return PointFileFormat::KITTI_BIN;
+        }
+        if (extension == "pcd") {
+            return PointFileFormat::PCD;
+        }
+        if (extension == "ply") {
+            return PointFileFormat::PLY;
+        }
+        return PointFileFormat::AUTO;
+    }
+
+    std::optional<PointFileLayout> PointFileLayoutParser::parse(
+        const PointFileFormat format, const std::string_view contents
+    ) {
+        // Records are read in place, so their byte order must match the host
+        if constexpr (std::endian::native != std::endian::little) {
+            return std::nullopt;
+        }
+
+        switch (format) {
+            case PointFileFormat::KITTI_BIN:
+                return parseKitti(contents);
+            case PointFileFormat::PCD:
+                return parsePcd(contents);
+            case PointFileFormat::PLY:
+                return parsePly(contents);
+            default:
+                return std::nullopt;
+        }
+    }
+
+    std::optional<PointFileLayout> PointFileLayoutParser::parseKitti(const std::string_view contents) {
+        if (contents.size() % KITTI_RECORD_SIZE != 0) {
+            return std::nullopt;
+        }
+
+        return PointFileLayout{
+            .dataOffset = 0, .pointsCount = contents.size() / KITTI_RECORD_SIZE, .stride = KITTI_RECORD_SIZE,
+            .xOffset = 0, .yOffset = sizeof(float), .zOffset = 2 * sizeof(float)
+        };
+    }
+
+    std::optional<PointFileLayout> PointFileLayoutParser::parsePcd(const std::string_view contents) {
+        std::vector<PointField> fields;
+        std::optional<uint64_t> pointsCount;
+        uint64_t position = 0;
+
+        while (const std::optional<std::string_view> line = nextLine(contents, position)) {
+            const std::vector<std::string> tokens = tokenize(*line);
+            if (tokens.empty() || tokens[0].starts_with('#')) {
+                continue;
+            }
+
+            const std::string &key = tokens[0];
+            const uint64_t valuesCount = tokens.size() - 1;
+
+            if (key == "FIELDS") {
+                fields.resize(valuesCount);
+                for (uint64_t i = 0; i < valuesCount; ++i) {
+                    fields[i].name = tokens[i + 1];
+                }
+            } else if (key == "SIZE" || key == "TYPE" || key == "COUNT") {
+                if (valuesCount != fields.size()) {
+                    return std::nullopt;
+                }
+
+                for (uint64_t i = 0; i < valuesCount; ++i) {
+                    const std::string &value = tokens[i + 1];
+                    if (key == "TYPE") {
+                        fields[i].isFloat = value == "F";
+                        continue;
+                    }
+
+                    const std::optional<uint64_t> number = toUnsigned(value);
+                    if (!number) {
+                        return std::nullopt;
+                    }
+                    (key == "SIZE" ? fields[i].size : fields[i].count) = *number;
+                }
+            } else if (key == "POINTS" && valuesCount == 1) {
+                pointsCount = toUnsigned(tokens[1]);
+            } else if (key == "DATA") {
+                // ASCII and compressed payloads cannot be read in place
+                if (valuesCount != 1 || tokens[1] != "binary" || !pointsCount) {
+                    return std::nullopt;
+                }
+                return buildLayout(fields, position, *pointsCount, contents.size());
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<PointFileLayout> PointFileLayoutParser::parsePly(const std::string_view contents) {
+        uint64_t position = 0;
+        if (nextLine(contents, position) != "ply") {
+            return std::nullopt;
+        }
+
+        std::vector<PointField> fields;
+        std::optional<uint64_t> pointsCount;
+        bool inVertexElement = false;
+        bool isBinaryLittleEndian = false;
+
+        while (const std::optional<std::string_view> line = nextLine(contents, position)) {
+            const std::vector<std::string> tokens = tokenize(*line);
+            if (tokens.empty()) {
+                continue;
+            }
+
+            const std::string &key = tokens[0];
+
+            if (key == "format") {
+                isBinaryLittleEndian = tokens.size() >= 2 && tokens[1] == "binary_little_endian";
+            } else if (key == "element") {
+                // The vertex records are only located without parsing other elements when they come first
+                if (tokens.size() != 3 || (!pointsCount && tokens[1] != "vertex")) {
+                    return std::nullopt;
+                }
+
+                inVertexElement = !pointsCount;
+                if (inVertexElement) {
+                    pointsCount = toUnsigned(tokens[2]);
+                    if (!pointsCount) {
+                        return std::nullopt;
+                    }
+                }
+            } else if (key == "property" && inVertexElement) {
+                if (tokens.size() != 3 || plyTypeSize(tokens[1]) == 0) {
+                    return std::nullopt;
+                }
+
+                const bool isFloat = tokens[1] == "float" || tokens[1] == "float32";
+                fields.emplace_back(PointField{tokens[2], plyTypeSize(tokens[1]), 1, isFloat});
+            } else if (key == "end_header") {
+                if (!isBinaryLittleEndian || !pointsCount) {
+                    return std::nullopt;
+                }
+                return buildLayout(fields, position, *pointsCount, contents.size());
+            }
+        }
+
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include "alice_lri/PointCloudReader.hpp"
+
+namespace alice_lri {
+    // Position of the float32 x, y and z fields inside the fixed size records of a binary point file
+    struct PointFileLayout {
+        uint64_t dataOffset = 0;
+        uint64_t pointsCount = 0;
+        uint64_t stride = 0;
+        uint64_t xOffset = 0, yOffset = 0, zOffset = 0;
+    };
+
+    class PointFileLayoutParser {
+    public:
+        static PointFileFormat detectFormat(std::string_view path);
+
+        // Empty if the header is malformed, the fields are not float32, or the file is shorter than the records
+        static std::optional<PointFileLayout> parse(PointFileFormat format, std::string_view contents);
+
+    private:
+        static std::optional<PointFileLayout> parseKitti(std::string_view contents);
+        static std::optional<PointFileLayout> parsePcd(std::string_view contents);
+        static std::optional<PointFileLayout> parsePly(std::string_view contents);
+    };
+}
@@ -0,0 +1,187 @@
+#include "math/FastMath.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+namespace alice_lri::FastMath {
+    namespace {
+        using Eigen::internal::padd;
+        using Eigen::internal::psub;
+        using Eigen::internal::pmul;
+        using Eigen::internal::pdiv;
+        using Eigen::internal::pmadd;
+        using Eigen::internal::pabs;
+        using Eigen::internal::pmin;
+        using Eigen::internal::pmax;
+        using Eigen::internal::psqrt;
+        using Eigen::internal::pand;
+        using Eigen::internal::por;
+        using Eigen::internal::pandnot;
+        using Eigen::internal::ptrue;
+        using Eigen::internal::pselect;
+        using Eigen::internal::pcmp_lt;
+        using Eigen::internal::pcmp_le;
+        using Eigen::internal::pcmp_eq;
+
+        using Packet = Eigen::internal::packet_traits<double>::type;
+        constexpr Eigen::Index PACKET_SIZE = Eigen::internal::packet_traits<double>::size;
+
+        // Cephes rational approximation of (atan(x) - x) / x on [0, 0.66]
+        constexpr double ATAN_P[] = {
+            -8.750608600031904122785e-01, -1.615753718733365076637e+01, -7.500855792314704667340e+01,
+            -1.228866684490136173410e+02, -6.485021904942025371773e+01
+        };
+        constexpr double ATAN_Q[] = {
+            2.485846490142306297962e+01, 1.650270098316988542046e+02, 4.328810604912902668951e+02,
+            4.853903996359136964868e+02, 1.945506571482613964425e+02
+        };
+        constexpr double ATAN_REDUCTION_THRESHOLD = 0.66;
+
+        // Low parts of pi / 2 and pi, i.e. the difference between the exact value and the nearest double
+        constexpr double PI_2_LO = 6.123233995736765886130e-17;
+        constexpr double PI_LO = 1.2246467991473532e-16;
+
+        Packet set(const double value) {
+            return Eigen::internal::pset1<Packet>(value);
+        }
+
+        Packet signBit(const Packet &value) {
+            return pand(value, set(-0.0));
+        }
+
+        Packet load(const double *data, const Eigen::Index count) {
+            if (count == PACKET_SIZE) {
+                return Eigen::internal::ploadu<Packet>(data);
+            }
+
+            // Tail lanes are padded with a value that is valid for every kernel
+            double buffer[PACKET_SIZE];
+            std::fill_n(buffer, PACKET_SIZE, 1.0);
+            std::copy_n(data, count, buffer);
+            return Eigen::internal::ploadu<Packet>(buffer);
+        }
+
+        void store(double *data, const Eigen::Index count, const Packet &value) {
+            if (count == PACKET_SIZE) {
+                Eigen::internal::pstoreu(data, value);
+                return;
+            }
+
+            double buffer[PACKET_SIZE];
+            Eigen::internal::pstoreu(buffer, value);
+            std::copy_n(buffer, count, data);
+        }
+
+        // Calls fallback(lane) for every lane of the packet whose mask is set
+        template<typename Fallback>
+        void fixSpecialLanes(const Packet &special, const Eigen::Index count, Fallback &&fallback) {
+            if (!Eigen::internal::predux_any(special)) {
+                return;
+            }
+
+            double mask[PACKET_SIZE];
+            Eigen::internal::pstoreu(mask, special);
+
+            for (Eigen::Index lane = 0; lane < count; ++lane) {
+                if (std::bit_cast<uint64_t>(mask[lane]) != 0) {
+                    fallback(lane);
+                }
+            }
+        }
+
+        // atan(t) for t in [0, 1]
+        Packet atanUnit(const Packet &t) {
+            const Packet one = set(1);
+            const Packet reduce = pcmp_lt(set(ATAN_REDUCTION_THRESHOLD), t);
+            const Packet arg = pselect(reduce, pdiv(psub(t, one), padd(t, one)), t);
+            const Packet z = pmul(arg, arg);
+
+            Packet p = set(ATAN_P[0]);
+            for (int i = 1; i < 5; ++i) {
+                p = pmadd(p, z, set(ATAN_P[i]));
+            }
+
+            Packet q = padd(z, set(ATAN_Q[0]));
+            for (int i = 1; i < 5; ++i) {
+                q = pmadd(q, z, set(ATAN_Q[i]));
+            }
+
+            const Packet result = pmadd(arg, pdiv(pmul(z, p), q), arg);
+            const Packet reduced = padd(padd(set(std::numbers::pi / 4), result), set(PI_2_LO / 2));
+            return pselect(reduce, reduced, result);
+        }
+
+        Packet atan2Packet(const Packet &y, const Packet &x, Packet &special) {
+            const Packet absY = pabs(y);
+            const Packet absX = pabs(x);
+            const Packet denominator = pmax(absY, absX);
+
+            Packet result = atanUnit(pdiv(pmin(absY, absX), denominator));
+            const Packet complement = padd(psub(set(std::numbers::pi / 2), result), set(PI_2_LO));
+            result = pselect(pcmp_lt(absX, absY), complement, result);
+            const Packet supplement = padd(psub(set(std::numbers::pi), result), set(PI_LO));
+            result = pselect(pcmp_lt(x, set(0)), supplement, result);
+
+            // Zeros, infinities and NaN, for which the ratio above is meaningless
+            const Packet valid = pand(
+                pand(pcmp_lt(set(0), denominator), pcmp_lt(denominator, set(std::numeric_limits<double>::infinity()))),
+                pand(pcmp_eq(x, x), pcmp_eq(y, y))
+            );
+            special = pandnot(ptrue(valid), valid);
+
+            return por(result, signBit(y));
+        }
+
+        Packet asinPacket(const Packet &x, Packet &special) {
+            const Packet one = set(1);
+            const Packet cosine = psqrt(pmul(psub(one, x), padd(one, x)));
+            const Packet result = atan2Packet(x, cosine, special);
+
+            const Packet valid = pcmp_le(pabs(x), one);
+            special = por(special, pandnot(ptrue(valid), valid));
+
+            return result;
+        }
+    }
+
+    void atan2(
+        const Eigen::Ref<const Eigen::ArrayXd> &y, const Eigen::Ref<const Eigen::ArrayXd> &x,
+        Eigen::Ref<Eigen::ArrayXd> result
+    ) {
+        const Eigen::Index size = x.size();
+
+        for (Eigen::Index i = 0; i < size; i += PACKET_SIZE) {
+            const Eigen::Index count = std::min(PACKET_SIZE, size - i);
+            const Packet yPacket = load(y.data() + i, count);
+            const Packet xPacket = load(x.data() + i, count);
+            Packet special;
+
+            store(result.data() + i, count, atan2Packet(yPacket, xPacket, special));
+            fixSpecialLanes(special, count, [&](const Eigen::Index lane) {
+                double yLanes[PACKET_SIZE], xLanes[PACKET_SIZE];
+                Eigen::internal::pstoreu(yLanes, yPacket);
+                Eigen::internal::pstoreu(xLanes, xPacket);
+                result(i + lane) = std::atan2(yLanes[lane], xLanes[lane]);
+            });
+        }
+    }
+
+    void asin(const Eigen::Ref<const Eigen::ArrayXd> &x, Eigen::Ref<Eigen::ArrayXd> result) {
+        const Eigen::Index size = x.size();
+
+        for (Eigen::Index i = 0; i < size; i += PACKET_SIZE) {
+            const Eigen::Index count = std::min(PACKET_SIZE, size - i);
+            const Packet xPacket = load(x.data() + i, count);
+            Packet special;
+
+            store(result.data() + i, count, asinPacket(xPacket, special));
+            fixSpecialLanes(special, count, [&](const Eigen::Index lane) {
+                double xLanes[PACKET_SIZE];
+                Eigen::internal::pstoreu(xLanes, xPacket);
+                result(i + lane) = std::asin(xLanes[lane]);
+            });
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <limits>
+#include <Eigen/Core>
+
+namespace alice_lri::FastMath {
+    // Largest error of the kernels against libm, in units in the last place of the result. Checked in the tests
+    constexpr double ATAN2_MAX_ULP = 4;
+    constexpr double ASIN_MAX_ULP = 4;
+
+    // Absolute error bounds derived from the above: |atan2| < 4 and |asin| < 2, so one ulp is at most 2 or 1 epsilon
+    constexpr double ATAN2_MAX_ABS_ERROR = ATAN2_MAX_ULP * 2 * std::numeric_limits<double>::epsilon();
+    constexpr double ASIN_MAX_ABS_ERROR = ASIN_MAX_ULP * std::numeric_limits<double>::epsilon();
+
+    // Batched kernels vectorized with Eigen packets. Zeros, infinities, NaN and out of range arguments fall back to
+    // libm, so only the error bounds above differ from the standard functions. The output may alias the input
+    void atan2(
+        const Eigen::Ref<const Eigen::ArrayXd> &y, const Eigen::Ref<const Eigen::ArrayXd> &x,
+        Eigen::Ref<Eigen::ArrayXd> result
+    );
+    void asin(const Eigen::Ref<const Eigen::ArrayXd> &x, Eigen::Ref<Eigen::ArrayXd> result);
+}
@@ -4,25 +4,33 @@
 
 namespace alice_lri {
 
-    LRResult LinearRegressor::fit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, const bool computeMse) {
-        const double n = static_cast<double>(x.size());
-        const double Sx = x.sum();
-        const double Sy = y.sum();
-        const double Sxx = x.square().sum();
-        const double Sxy = (x * y).sum();
-
-        const double Delta = n * Sxx - Sx * Sx;
-        const double slope = (n * Sxy - Sx * Sy) / Delta;
-        const double intercept = (Sxx * Sy - Sx * Sxy) / Delta;
+    LRResult LinearRegressor::fit(
+        const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y, const bool computeMse
+    ) {
+        const LRSums sums = {
+            .n = static_cast<double>(x.size()),
+            .x = x.sum(),
+            .y = y.sum(),
+            .xx = x.square().sum(),
+            .xy = (x * y).sum()
+        };
 
-        std::optional<double> mse;
+        LRResult result = fit(sums);
         if (computeMse) {
-            const auto yPred = slope * x + intercept;
+            const auto yPred = result.slope * x + result.intercept;
             const auto residuals = y - yPred;
-            mse = residuals.square().mean();
+            result.mse = residuals.square().mean();
         }
 
-        return LRResult(slope, intercept, mse);
+        return result;
+    }
+
+    LRResult LinearRegressor::fit(const LRSums &sums) {
+        const double Delta = sums.n * sums.xx - sums.x * sums.x;
+        const double slope = (sums.n * sums.xy - sums.x * sums.y) / Delta;
+        const double intercept = (sums.xx * sums.y - sums.x * sums.xy) / Delta;
+
+        return LRResult(slope, intercept);
     }
 
     WLSResult LinearRegressor::wlsBoundsFit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, const Eigen::ArrayXd &bounds) {
@@ -25,8 +25,29 @@ namespace alice_lri {
             : slope(slope), intercept(intercept), mse(mse) {}
     };
 
+    struct LRSums {
+        double n = 0;
+        double x = 0;
+        double y = 0;
+        double xx = 0;
+        double xy = 0;
+
+        void add(const double xi, const double yi) {
+            n += 1;
+            x += xi;
+            y += yi;
+            xx += xi * xi;
+            xy += xi * yi;
+        }
+    };
+
     namespace LinearRegressor {
-        LRResult fit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, bool computeMse = false);
+        LRResult fit(const LRSums &sums);
+
+        LRResult fit(
+            const Eigen::Ref<const Eigen::ArrayXd> &x, const Eigen::Ref<const Eigen::ArrayXd> &y,
+            bool computeMse = false
+        );
         WLSResult wlsBoundsFit(const Eigen::ArrayXd &x, const Eigen::ArrayXd &y, const Eigen::ArrayXd &bounds);
     }
 }
@@ -3,29 +3,50 @@
 #include "utils/Timer.h"
 
 namespace alice_lri::Stats {
-    double weightedMedian(const std::span<const double> values, const std::span<const int32_t> weights) {
+    double weightedMedian(const std::span<double> values, const std::span<int32_t> weights) {
         const std::size_t n = values.size();
         if (n == 0 || weights.size() != n) {
             throw std::invalid_argument("Mismatched sizes or empty input in computeWeightedMedianSpan");
         }
 
-        std::vector<std::size_t> indices(n);
-        std::iota(indices.begin(), indices.end(), 0);
+        // Weighted quickselect for the smallest value whose cumulative weight reaches half of the total weight
+        const int64_t totalWeight = std::accumulate(weights.begin(), weights.end(), int64_t{0});
+        int64_t weightBelow = 0;
+        std::size_t lo = 0, hi = n;
 
-        std::ranges::sort(indices, [&](const std::size_t a, const std::size_t b) {
-            return values[a] < values[b];
-        });
+        while (hi - lo > 1) {
+            const double pivot = values[lo + (hi - lo) / 2];
 
-        const double totalWeight = std::accumulate(weights.begin(), weights.end(), 0.0);
-        double cumulativeWeight = 0.0;
+            // Three-way partition of [lo, hi) into [lo, lt) < pivot, [lt, i) == pivot and [gt, hi) > pivot
+            std::size_t lt = lo, i = lo, gt = hi;
+            int64_t weightLess = 0, weightEqual = 0;
+            while (i < gt) {
+                if (values[i] < pivot) {
+                    weightLess += weights[i];
+                    std::swap(values[i], values[lt]);
+                    std::swap(weights[i], weights[lt]);
+                    ++lt;
+                    ++i;
+                } else if (values[i] > pivot) {
+                    --gt;
+                    std::swap(values[i], values[gt]);
+                    std::swap(weights[i], weights[gt]);
+                } else {
+                    weightEqual += weights[i];
+                    ++i;
+                }
+            }
 
-        for (const std::size_t idx : indices) {
-            cumulativeWeight += weights[idx];
-            if (cumulativeWeight >= totalWeight / 2.0) {
-                return values[idx];
+            if (2 * (weightBelow + weightLess) >= totalWeight) {
+                hi = lt;
+            } else if (2 * (weightBelow + weightLess + weightEqual) >= totalWeight || gt == hi) {
+                return pivot;
+            } else {
+                weightBelow += weightLess + weightEqual;
+                lo = gt;
             }
         }
 
-        return values[indices.back()];
+        return values[lo];
     }
 }
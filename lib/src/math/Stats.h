@@ -3,5 +3,6 @@
 #include <Eigen/Core>
 
 namespace alice_lri::Stats {
-    double weightedMedian(std::span<const double> values, std::span<const int32_t> weights);
+    // Reorders values and weights in place
+    double weightedMedian(std::span<double> values, std::span<int32_t> weights);
 }
@@ -4,30 +4,17 @@
 #include "Constants.h"
 
 namespace alice_lri::Trigonometry {
-    const std::array<double, TRIG_TABLE_SIZE>& getSinTable() {
-        static const std::array<double, TRIG_TABLE_SIZE> lut = [] {
-            std::array<double, TRIG_TABLE_SIZE> table{};
+    const SinCos *sinCosTable() {
+        static const std::array<SinCos, TRIG_TABLE_SIZE> lut = [] {
+            std::array<SinCos, TRIG_TABLE_SIZE> table{};
             for (int i = 0; i < TRIG_TABLE_SIZE; ++i) {
                 const double angle = (Constant::TWO_PI * i) / TRIG_TABLE_SIZE;
-                table[i] = std::sin(angle);
+                table[i] = {std::sin(angle), std::cos(angle)};
             }
             return table;
         }();
 
-        return lut;
-    }
-
-    const std::array<double, TRIG_TABLE_SIZE>& getCosTable() {
-        static const std::array<double, TRIG_TABLE_SIZE> lut = [] {
-            std::array<double, TRIG_TABLE_SIZE> table{};
-            for (int i = 0; i < TRIG_TABLE_SIZE; ++i) {
-                const double angle = (Constant::TWO_PI * i) / TRIG_TABLE_SIZE;
-                table[i] = std::cos(angle);
-            }
-            return table;
-        }();
-
-        return lut;
+        return lut.data();
     }
 
     int32_t radiansToIndex(const double radians) {
@@ -39,11 +26,11 @@ namespace alice_lri::Trigonometry {
     }
 
     double sinIndex(const int32_t index) {
-        return getSinTable()[index];
+        return sinCosTable()[index].sin;
     }
 
     double cosIndex(const int32_t index) {
-        return getCosTable()[index];
+        return sinCosTable()[index].cos;
     }
 
     double sin(const double radians) {
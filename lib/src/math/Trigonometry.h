@@ -4,6 +4,14 @@
 namespace alice_lri::Trigonometry {
     constexpr uint32_t TRIG_TABLE_SIZE = 65536;
 
+    struct SinCos {
+        double sin;
+        double cos;
+    };
+
+    // Interleaved sine and cosine of TWO_PI * i / TRIG_TABLE_SIZE, so that each lookup touches a single cache line
+    const SinCos *sinCosTable();
+
     double sinIndex(int32_t index);
     double cosIndex(int32_t index);
     double sin(double radians);
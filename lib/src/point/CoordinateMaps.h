@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <Eigen/Core>
+#include "alice_lri/Structs.hpp"
+
+namespace alice_lri {
+    // Read-only maps over the caller's coordinate buffers. Contiguous views keep a compile time unit stride, so that
+    // expressions over them stay vectorized
+    template<typename Scalar, typename Stride = Eigen::InnerStride<1>>
+    using CoordinateMap = Eigen::Map<const Eigen::ArrayX<Scalar>, 0, Stride>;
+
+    template<typename Scalar, typename Stride = Eigen::InnerStride<1>>
+    struct CoordinateMaps {
+        CoordinateMap<Scalar, Stride> x, y, z;
+    };
+
+    template<typename Scalar>
+    using StridedCoordinateMaps = CoordinateMaps<Scalar, Eigen::InnerStride<>>;
+
+    namespace CoordinateMapsDetail {
+        template<typename Scalar, typename View>
+        const Scalar *field(const View &points, const uint64_t offset) {
+            return reinterpret_cast<const Scalar *>(static_cast<const std::byte *>(points.base) + offset);
+        }
+
+        // A field must be aligned to a whole scalar and end within its record, so that the last record does not
+        // read past the caller's buffer
+        template<typename Scalar>
+        bool isValidField(const uint64_t offset, const uint64_t stride) {
+            return offset % sizeof(Scalar) == 0 && offset <= stride - sizeof(Scalar);
+        }
+
+        template<typename Scalar, typename View>
+        bool hasValidLayout(const View &points) {
+            const auto address = reinterpret_cast<uintptr_t>(points.base);
+
+            return address % alignof(Scalar) == 0 && points.stride % sizeof(Scalar) == 0 && points.stride > 0 &&
+                isValidField<Scalar>(points.xOffset, points.stride) &&
+                isValidField<Scalar>(points.yOffset, points.stride) &&
+                isValidField<Scalar>(points.zOffset, points.stride);
+        }
+
+        template<typename Scalar, typename View>
+        StridedCoordinateMaps<Scalar> mapStrided(const View &points) {
+            const auto size = static_cast<Eigen::Index>(points.size);
+            const Eigen::InnerStride<> stride(static_cast<Eigen::Index>(points.stride / sizeof(Scalar)));
+
+            return {
+                {field<Scalar>(points, points.xOffset), size, stride},
+                {field<Scalar>(points, points.yOffset), size, stride},
+                {field<Scalar>(points, points.zOffset), size, stride}
+            };
+        }
+    }
+
+    inline bool hasData(const PointCloud::FloatView &points) { return points.x && points.y && points.z; }
+    inline bool hasData(const PointCloud::DoubleView &points) { return points.x && points.y && points.z; }
+    inline bool hasData(const PointCloud::FloatStridedView &points) { return points.base; }
+    inline bool hasData(const PointCloud::DoubleStridedView &points) { return points.base; }
+
+    // Strided fields are reinterpreted in place, so they must be aligned to whole scalars and lie within a record
+    inline bool hasValidLayout(const PointCloud::FloatView &) { return true; }
+    inline bool hasValidLayout(const PointCloud::DoubleView &) { return true; }
+
+    inline bool hasValidLayout(const PointCloud::FloatStridedView &points) {
+        return CoordinateMapsDetail::hasValidLayout<float>(points);
+    }
+
+    inline bool hasValidLayout(const PointCloud::DoubleStridedView &points) {
+        return CoordinateMapsDetail::hasValidLayout<double>(points);
+    }
+
+    inline CoordinateMaps<float> mapCoordinates(const PointCloud::FloatView &points) {
+        const auto size = static_cast<Eigen::Index>(points.size);
+        return {{points.x, size}, {points.y, size}, {points.z, size}};
+    }
+
+    inline CoordinateMaps<double> mapCoordinates(const PointCloud::DoubleView &points) {
+        const auto size = static_cast<Eigen::Index>(points.size);
+        return {{points.x, size}, {points.y, size}, {points.z, size}};
+    }
+
+    inline StridedCoordinateMaps<float> mapCoordinates(const PointCloud::FloatStridedView &points) {
+        return CoordinateMapsDetail::mapStrided<float>(points);
+    }
+
+    inline StridedCoordinateMaps<double> mapCoordinates(const PointCloud::DoubleStridedView &points) {
+        return CoordinateMapsDetail::mapStrided<double>(points);
+    }
+}
@@ -1,22 +1,94 @@
 #include "PointArray.h"
 #include "PointUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "math/FastMath.h"
+#include "utils/Parallel.h"
+
+constexpr int64_t EXTRA_INFO_BLOCK_SIZE = 4096;
 
 namespace alice_lri {
     void PointArray::computeExtraInfo() {
         extraInfo.coordsEps = PointUtils::computeCoordsEps(*this);
 
-        const Eigen::ArrayXd &rangeXySquared = x.square() + y.square();
+        const auto pointsCount = static_cast<int64_t>(x.size());
+        extraInfo.range.resize(pointsCount);
+        extraInfo.phi.resize(pointsCount);
+        extraInfo.invRange.resize(pointsCount);
+
+        // The eager fields and the range bounds are computed in a single pass over blocks of points
+        const int64_t blocksCount = (pointsCount + EXTRA_INFO_BLOCK_SIZE - 1) / EXTRA_INFO_BLOCK_SIZE;
+        std::vector<double> blockMinRanges(blocksCount), blockMaxRanges(blocksCount);
+
+        Parallel::parallelFor(0, blocksCount, [&](const int64_t block) {
+            const int64_t blockBegin = block * EXTRA_INFO_BLOCK_SIZE;
+            const int64_t blockEnd = std::min(blockBegin + EXTRA_INFO_BLOCK_SIZE, pointsCount);
+            double minRange = std::numeric_limits<double>::infinity();
+            double maxRange = -std::numeric_limits<double>::infinity();
+
+            for (int64_t i = blockBegin; i < blockEnd; ++i) {
+                const double range = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+
+                extraInfo.range[i] = range;
+                extraInfo.phi[i] = z[i] / range;
+                extraInfo.invRange[i] = 1 / range;
 
-        extraInfo.rangeXy = rangeXySquared.sqrt();
-        extraInfo.range = (rangeXySquared + z.square()).sqrt();
-        extraInfo.phi = (z / extraInfo.range).asin();
-        extraInfo.theta = y.binaryExpr(x, [](const double yi, const double xi) {
-            return std::atan2(yi, xi);
+                minRange = std::min(minRange, range);
+                maxRange = std::max(maxRange, range);
+            }
+
+            const int64_t blockSize = blockEnd - blockBegin;
+            FastMath::asin(extraInfo.phi.segment(blockBegin, blockSize), extraInfo.phi.segment(blockBegin, blockSize));
+
+            blockMinRanges[block] = minRange;
+            blockMaxRanges[block] = maxRange;
         });
 
-        extraInfo.invRange = extraInfo.range.inverse();
-        extraInfo.invRangeXy = extraInfo.rangeXy.inverse();
-        extraInfo.maxRange = extraInfo.range.maxCoeff();
-        extraInfo.minRange = extraInfo.range.minCoeff();
+        extraInfo.minRange = *std::ranges::min_element(blockMinRanges);
+        extraInfo.maxRange = *std::ranges::max_element(blockMaxRanges);
+    }
+
+    Eigen::ArrayXd PointArray::computeRangesXy() const {
+        return (x.square() + y.square()).sqrt();
+    }
+
+    Eigen::ArrayXd PointArray::computeThetas() const {
+        const auto pointsCount = static_cast<int64_t>(x.size());
+        Eigen::ArrayXd thetas(pointsCount);
+
+        const int64_t blocksCount = (pointsCount + EXTRA_INFO_BLOCK_SIZE - 1) / EXTRA_INFO_BLOCK_SIZE;
+
+        Parallel::parallelFor(0, blocksCount, [&](const int64_t block) {
+            const int64_t blockBegin = block * EXTRA_INFO_BLOCK_SIZE;
+            const int64_t blockSize = std::min(EXTRA_INFO_BLOCK_SIZE, pointsCount - blockBegin);
+            FastMath::atan2(
+                y.segment(blockBegin, blockSize), x.segment(blockBegin, blockSize), thetas.segment(blockBegin, blockSize)
+            );
+        });
+
+        return thetas;
+    }
+
+    void PointArray::releaseHorizontalFields() {
+        extraInfo.rangeXy.release();
+        extraInfo.theta.release();
+        extraInfo.invRangeXy.release();
+    }
+
+    PointArray PointArray::select(const Eigen::ArrayXi &indices) const {
+        // Lazy fields of the selection are left to be computed on demand from its own coordinates
+        PointArrayExtraInfo selectedInfo;
+        selectedInfo.range = extraInfo.range(indices);
+        selectedInfo.phi = extraInfo.phi(indices);
+        selectedInfo.invRange = extraInfo.invRange(indices);
+        selectedInfo.maxRange = selectedInfo.range.maxCoeff();
+        selectedInfo.minRange = selectedInfo.range.minCoeff();
+        // The coordinates quantization is a property of the sensor, so it is kept from the full point cloud
+        selectedInfo.coordsEps = extraInfo.coordsEps;
+
+        return {x(indices), y(indices), z(indices), std::move(selectedInfo)};
     }
 }
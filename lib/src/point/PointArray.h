@@ -1,10 +1,33 @@
 #pragma once
+#include <memory>
+#include <mutex>
 #include <Eigen/Dense>
 
 namespace alice_lri {
+    // Derived field that is computed on first access and can be released once its last consumer is done. Access is
+    // thread-safe, while releasing needs the field to be held mutably, so that shared const arrays are never released
+    class LazyPointField {
+    private:
+        mutable Eigen::ArrayXd values;
+        mutable std::unique_ptr<std::once_flag> computed = std::make_unique<std::once_flag>();
+
+    public:
+        template<typename Compute>
+        const Eigen::ArrayXd &get(const Compute &compute) const {
+            std::call_once(*computed, [&] { values = compute(); });
+            return values;
+        }
+
+        void release() {
+            values = Eigen::ArrayXd();
+            computed = std::make_unique<std::once_flag>();
+        }
+    };
+
+    // Fields needed from the start of the vertical stage are computed eagerly, the rest on demand
     struct PointArrayExtraInfo {
-        Eigen::ArrayXd range, rangeXy, phi, theta;
-        Eigen::ArrayXd invRange, invRangeXy;
+        Eigen::ArrayXd range, phi, invRange;
+        LazyPointField rangeXy, theta, invRangeXy;
         double maxRange = 0, minRange = 0;
         double coordsEps = 0;
     };
@@ -46,27 +69,43 @@ namespace alice_lri {
         [[nodiscard]] inline const Eigen::ArrayXd& getZs() const { return z; }
 
         [[nodiscard]] inline double getRange(const size_t index) const { return extraInfo.range[index]; }
-        [[nodiscard]] inline double getRangeXy(const size_t index) const { return extraInfo.rangeXy[index]; }
+        [[nodiscard]] inline double getRangeXy(const size_t index) const { return getRangesXy()[index]; }
         [[nodiscard]] inline double getPhi(const size_t index) const { return extraInfo.phi[index]; }
-        [[nodiscard]] inline double getTheta(const size_t index) const { return extraInfo.theta[index]; }
+        [[nodiscard]] inline double getTheta(const size_t index) const { return getThetas()[index]; }
         [[nodiscard]] inline double getCoordsEps() const { return extraInfo.coordsEps; }
 
         [[nodiscard]] inline double getInvRange(const size_t index) const { return extraInfo.invRange[index]; }
-        [[nodiscard]] inline double getInvRangeXy(const size_t index) const { return extraInfo.invRangeXy[index]; }
+        [[nodiscard]] inline double getInvRangeXy(const size_t index) const { return getInvRangesXy()[index]; }
 
         [[nodiscard]] inline const Eigen::ArrayXd& getRanges() const { return extraInfo.range; }
-        [[nodiscard]] inline const Eigen::ArrayXd& getRangesXy() const { return extraInfo.rangeXy; }
+        [[nodiscard]] inline const Eigen::ArrayXd& getRangesXy() const {
+            return extraInfo.rangeXy.get([this] { return computeRangesXy(); });
+        }
         [[nodiscard]] inline const Eigen::ArrayXd& getPhis() const { return extraInfo.phi; }
-        [[nodiscard]] inline const Eigen::ArrayXd& getThetas() const { return extraInfo.theta; }
+        [[nodiscard]] inline const Eigen::ArrayXd& getThetas() const {
+            return extraInfo.theta.get([this] { return computeThetas(); });
+        }
 
         [[nodiscard]] inline const Eigen::ArrayXd& getInvRanges() const { return extraInfo.invRange; }
-        [[nodiscard]] inline const Eigen::ArrayXd& getInvRangesXy() const { return extraInfo.invRangeXy; }
+        [[nodiscard]] inline const Eigen::ArrayXd& getInvRangesXy() const {
+            return extraInfo.invRangeXy.get([this] { return Eigen::ArrayXd(1 / getRangesXy()); });
+        }
         [[nodiscard]] inline double getMaxRange() const { return extraInfo.maxRange; }
         [[nodiscard]] inline double getMinRange() const { return extraInfo.minRange; }
 
         [[nodiscard]] size_t size() const { return x.size(); }
 
+        [[nodiscard]] PointArray select(const Eigen::ArrayXi &indices) const;
+
+        // Frees the fields only read by the horizontal stage. They are recomputed if accessed again
+        void releaseHorizontalFields();
+
     private:
+        PointArray(Eigen::ArrayXd &&x_, Eigen::ArrayXd &&y_, Eigen::ArrayXd &&z_, PointArrayExtraInfo &&extraInfo_)
+            : x(std::move(x_)), y(std::move(y_)), z(std::move(z_)), extraInfo(std::move(extraInfo_)) { }
+
         void computeExtraInfo();
+        [[nodiscard]] Eigen::ArrayXd computeRangesXy() const;
+        [[nodiscard]] Eigen::ArrayXd computeThetas() const;
     };
 }
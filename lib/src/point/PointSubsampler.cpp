@@ -0,0 +1,78 @@
+#include "PointSubsampler.h"
+#include <algorithm>
+#include <cmath>
+#include "utils/Timer.h"
+
+constexpr int32_t PHI_BINS = 4096;
+constexpr int32_t RANGE_BINS = 8;
+
+namespace alice_lri {
+    bool PointSubsampler::shouldSubsample(const PointArray &points, const uint64_t targetSize) {
+        return targetSize > 0 && targetSize < points.size();
+    }
+
+    Eigen::ArrayXi PointSubsampler::stratifiedIndices(const PointArray &points, const uint64_t targetSize) {
+        PROFILE_SCOPE("PointSubsampler::stratifiedIndices");
+        const uint64_t pointsCount = points.size();
+        const std::vector<int32_t> cells = computeCells(points);
+
+        std::vector<uint64_t> cellStarts(PHI_BINS * RANGE_BINS + 1, 0);
+        for (const int32_t cell : cells) {
+            cellStarts[cell + 1]++;
+        }
+
+        for (size_t i = 1; i < cellStarts.size(); ++i) {
+            cellStarts[i] += cellStarts[i - 1];
+        }
+
+        std::vector<int32_t> cellOrder(pointsCount);
+        std::vector<uint64_t> cellFill(cellStarts.begin(), cellStarts.end() - 1);
+        for (uint64_t i = 0; i < pointsCount; ++i) {
+            cellOrder[cellFill[cells[i]]++] = static_cast<int32_t>(i);
+        }
+
+        // Systematic sampling over the points grouped by cell gives every cell its proportional share (rounded up or
+        // down) while keeping the total exactly equal to the target
+        std::vector<bool> selected(pointsCount, false);
+        for (uint64_t j = 0; j < pointsCount; ++j) {
+            if ((j + 1) * targetSize / pointsCount > j * targetSize / pointsCount) {
+                selected[cellOrder[j]] = true;
+            }
+        }
+
+        Eigen::ArrayXi indices(targetSize);
+        Eigen::Index count = 0;
+        for (uint64_t i = 0; i < pointsCount; ++i) {
+            if (selected[i]) {
+                indices[count++] = static_cast<int32_t>(i);
+            }
+        }
+
+        return indices;
+    }
+
+    std::vector<int32_t> PointSubsampler::computeCells(const PointArray &points) {
+        const Eigen::ArrayXd &phis = points.getPhis();
+        const Eigen::ArrayXd &ranges = points.getRanges();
+
+        const double minPhi = phis.minCoeff();
+        const double phiSpan = phis.maxCoeff() - minPhi;
+        const double minLogRange = std::log(points.getMinRange());
+        const double logRangeSpan = std::log(points.getMaxRange()) - minLogRange;
+
+        const double phiScale = phiSpan > 0 ? PHI_BINS / phiSpan : 0;
+        const double rangeScale = logRangeSpan > 0 ? RANGE_BINS / logRangeSpan : 0;
+
+        std::vector<int32_t> cells(points.size());
+        for (Eigen::Index i = 0; i < phis.size(); ++i) {
+            const auto phiBin = std::min(static_cast<int32_t>((phis[i] - minPhi) * phiScale), PHI_BINS - 1);
+            const auto rangeBin = std::min(
+                static_cast<int32_t>((std::log(ranges[i]) - minLogRange) * rangeScale), RANGE_BINS - 1
+            );
+
+            cells[i] = phiBin * RANGE_BINS + rangeBin;
+        }
+
+        return cells;
+    }
+}
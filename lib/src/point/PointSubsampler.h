@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "PointArray.h"
+
+namespace alice_lri {
+    class PointSubsampler {
+    public:
+        static bool shouldSubsample(const PointArray &points, uint64_t targetSize);
+        static Eigen::ArrayXi stratifiedIndices(const PointArray &points, uint64_t targetSize);
+
+    private:
+        static std::vector<int32_t> computeCells(const PointArray &points);
+    };
+}
@@ -1,36 +1,107 @@
 #include "PointUtils.h"
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "utils/Parallel.h"
 
 constexpr double MIN_COORDS_EPS = 1e-6 / 2;
+constexpr int32_t RADIX_BITS = 11;
+constexpr uint64_t RADIX_MASK = (1 << RADIX_BITS) - 1;
+constexpr int32_t RADIX_PASSES = (64 + RADIX_BITS - 1) / RADIX_BITS;
 
 namespace alice_lri {
-    double PointUtils::computeCoordsEps(const PointArray &points) {
-        Eigen::ArrayXd sortedX = points.getX();
-        Eigen::ArrayXd sortedY = points.getY();
-        Eigen::ArrayXd sortedZ = points.getZ();
+    namespace {
+        // Maps a double to an unsigned key with the same ordering, so that values can be radix sorted by their bits
+        uint64_t toSortableKey(const double value) {
+            const auto bits = std::bit_cast<uint64_t>(value);
+            return bits & 0x8000000000000000 ? ~bits : bits | 0x8000000000000000;
+        }
+
+        double fromSortableKey(const uint64_t key) {
+            return std::bit_cast<double>(key & 0x8000000000000000 ? key & 0x7FFFFFFFFFFFFFFF : ~key);
+        }
+
+        // Smallest positive gap between consecutive sorted values, using a least significant digit radix sort. Passes
+        // where all keys share the same digit, such as most exponent bits of sensor data, are skipped
+        template<typename Values>
+        double minPositiveGap(const Values &values) {
+            const auto size = static_cast<size_t>(values.size());
+            std::vector<uint64_t> keys(size), buffer(size);
+            std::array<std::array<uint32_t, RADIX_MASK + 1>, RADIX_PASSES> histograms{};
 
-        std::ranges::sort(sortedX);
-        std::ranges::sort(sortedY);
-        std::ranges::sort(sortedZ);
+            for (size_t i = 0; i < size; ++i) {
+                keys[i] = toSortableKey(static_cast<double>(values[static_cast<Eigen::Index>(i)]));
+                for (int32_t pass = 0; pass < RADIX_PASSES; ++pass) {
+                    ++histograms[pass][(keys[i] >> (pass * RADIX_BITS)) & RADIX_MASK];
+                }
+            }
 
-        double minDiff = std::numeric_limits<double>::infinity();
+            for (int32_t pass = 0; pass < RADIX_PASSES; ++pass) {
+                auto &histogram = histograms[pass];
+                const int32_t shift = pass * RADIX_BITS;
 
-        for (int32_t i = 1; i < sortedX.size(); i++) {
-            const double diffX = sortedX[i] - sortedX[i - 1];
-            minDiff = diffX > 0 ? std::min(minDiff, diffX) : minDiff;
+                if (histogram[(keys.front() >> shift) & RADIX_MASK] == size) {
+                    continue;
+                }
 
-            const double diffY = sortedY[i] - sortedY[i - 1];
-            minDiff = diffY > 0 ? std::min(minDiff, diffY) : minDiff;
+                uint32_t offset = 0;
+                for (auto &count: histogram) {
+                    offset += std::exchange(count, offset);
+                }
 
-            const double diffZ = sortedZ[i] - sortedZ[i - 1];
-            minDiff = diffZ > 0 ? std::min(minDiff, diffZ) : minDiff;
+                for (const uint64_t key: keys) {
+                    buffer[histogram[(key >> shift) & RADIX_MASK]++] = key;
+                }
+
+                keys.swap(buffer);
+            }
+
+            double minDiff = std::numeric_limits<double>::infinity();
+            for (size_t i = 1; i < size; ++i) {
+                const double diff = fromSortableKey(keys[i]) - fromSortableKey(keys[i - 1]);
+                minDiff = diff > 0 ? std::min(minDiff, diff) : minDiff;
+            }
+
+            return minDiff;
         }
 
-        if (minDiff == std::numeric_limits<double>::infinity()) {
-            return MIN_COORDS_EPS;
+        // Float coordinates are widened exactly, so they measure the same step as their double copies would
+        template<typename Coordinates>
+        double measureCoordsEps(const Coordinates &x, const Coordinates &y, const Coordinates &z) {
+            if (x.size() < 2) {
+                return MIN_COORDS_EPS;
+            }
+
+            const std::array coordinates = {&x, &y, &z};
+            std::array<double, 3> minDiffs{};
+
+            Parallel::parallelFor(0, 3, [&](const int64_t axis) {
+                minDiffs[axis] = minPositiveGap(*coordinates[axis]);
+            });
+
+            const double minDiff = *std::ranges::min_element(minDiffs);
+
+            if (minDiff == std::numeric_limits<double>::infinity()) {
+                return MIN_COORDS_EPS;
+            }
+
+            return std::max(minDiff / 2, MIN_COORDS_EPS);
         }
+    }
+
+    double PointUtils::computeCoordsEps(const PointArray &points) {
+        return measureCoordsEps(points.getX(), points.getY(), points.getZ());
+    }
+
+    double PointUtils::computeCoordsEps(const CoordinateMaps<float> &points) {
+        return measureCoordsEps(points.x, points.y, points.z);
+    }
 
-        return std::max(minDiff / 2, MIN_COORDS_EPS);
+    double PointUtils::computeCoordsEps(const CoordinateMaps<double> &points) {
+        return measureCoordsEps(points.x, points.y, points.z);
     }
 }
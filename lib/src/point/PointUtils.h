@@ -1,10 +1,13 @@
 #pragma once
+#include "CoordinateMaps.h"
 #include "PointArray.h"
 
 namespace alice_lri {
     class PointUtils {
     public:
         static double computeCoordsEps(const PointArray& points);
+        static double computeCoordsEps(const CoordinateMaps<float>& points);
+        static double computeCoordsEps(const CoordinateMaps<double>& points);
     };
 
 
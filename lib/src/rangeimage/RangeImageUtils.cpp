@@ -1,168 +1,363 @@
 #include "RangeImageUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numbers>
 #include <numeric>
 #include <span>
+#include <type_traits>
+#include <vector>
 #include <Eigen/Core>
 #include "alice_lri/Structs.hpp"
+#include "math/FastMath.h"
+#include "rangeimage/ScanlineLookup.h"
 #include "utils/logger/Logger.h"
+#include "utils/Parallel.h"
 #include "utils/Timer.h"
 #include "utils/Utils.h"
 #include "Constants.h"
 
+constexpr int64_t PROJECTION_BLOCK_SIZE = 2048;
+
 namespace alice_lri::RangeImageUtils {
+    // Scanline lookup and image layout shared by all the points of a projection
+    struct ProjectionGrid {
+        std::span<const Scanline> scanlines;
+        ScanlineLookup lookup;
+        int32_t height;
+        // Width and offset in the pixel data of each row, followed by the total number of pixels
+        std::vector<uint32_t> rowWidths;
+        std::vector<int32_t> rowOffsets;
+
+        ProjectionGrid(const Intrinsics &intrinsics, double minRange, int64_t pointsCount, bool ragged);
+    };
+
+    // Per-point fields of a block of points. The scalar is not deduced from them, but from the coordinates
     template<typename Scalar>
-    RangeImage computeRangeImage(
-        const Intrinsics &intrinsics, const Eigen::ArrayX<Scalar> &x, const Eigen::ArrayX<Scalar> &y,
-        const Eigen::ArrayX<Scalar> &z
-    );
+    using BlockFields = Eigen::Ref<const Eigen::ArrayX<std::type_identity_t<Scalar>>>;
 
-    template<typename Scalar>
-    int32_t findBestScanline(
-        std::span<Scanline const> scanlines, const Eigen::ArrayX<Scalar> &ranges, const Eigen::ArrayX<Scalar> &phis, int32_t pointIdx
+    template<typename Image, typename Scalar, typename Stride>
+    Image computeRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<Scalar, Stride> &points);
+
+    template<typename Image>
+    Image computeRangeImage(const Intrinsics &intrinsics, const PointArray &points);
+
+    template<typename Scalar, typename Stride>
+    void computeBlockPixels(
+        const ProjectionGrid &grid, const CoordinateMaps<Scalar, Stride> &points, Eigen::Index begin,
+        const BlockFields<Scalar> &ranges, const BlockFields<Scalar> &rangesXy, const BlockFields<Scalar> &phis,
+        const BlockFields<Scalar> &thetas, Eigen::Ref<Eigen::ArrayXi> flatIndices
     );
 
-    template<typename Scalar>
-    RangeImage buildProjection(
-        const Intrinsics &intrinsics, const Eigen::ArrayXi &scanlinesByPoints, const Eigen::ArrayX<Scalar> &ranges,
-        const Eigen::ArrayXd &correctedThetas
+    template<typename Image, typename Scalar>
+    Image scatterPixels(
+        const ProjectionGrid &grid, const Eigen::ArrayX<Scalar> &ranges, const Eigen::ArrayXi &flatIndices
     );
 
+    template<typename Image>
+    PointCloud::Double computePointCloud(const Intrinsics &intrinsics, const Image &image);
+
+    int64_t blocksCount(int64_t pointsCount);
+
+    inline uint32_t rowWidth(const RangeImage &image, uint32_t row);
+    inline uint32_t rowWidth(const RaggedRangeImage &image, uint32_t row);
+
+    inline uint64_t rowOffset(const RangeImage &image, uint32_t row);
+    inline uint64_t rowOffset(const RaggedRangeImage &image, uint32_t row);
+
+    inline int32_t thetaToColumn(double correctedTheta, int32_t width);
+
     inline int32_t calculateLcmHorizontalResolution(const Intrinsics &intrinsics);
 
-    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Float &points) {
+    inline int32_t calculateMaxHorizontalResolution(const Intrinsics &intrinsics);
+
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<float> &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRangeImage");
+        return computeRangeImage<RangeImage>(intrinsics, points);
+    }
+
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<double> &points) {
         PROFILE_SCOPE("RangeImageUtils::projectToRangeImage");
-        const auto size = static_cast<Eigen::Index>(points.x.size());
+        return computeRangeImage<RangeImage>(intrinsics, points);
+    }
 
-        const Eigen::ArrayXf x = Eigen::Map<const Eigen::ArrayXf>(points.x.data(), size);
-        const Eigen::ArrayXf y = Eigen::Map<const Eigen::ArrayXf>(points.y.data(), size);
-        const Eigen::ArrayXf z = Eigen::Map<const Eigen::ArrayXf>(points.z.data(), size);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const StridedCoordinateMaps<float> &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRangeImage");
+        return computeRangeImage<RangeImage>(intrinsics, points);
+    }
 
-        return computeRangeImage(intrinsics, x, y, z);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const StridedCoordinateMaps<double> &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRangeImage");
+        return computeRangeImage<RangeImage>(intrinsics, points);
     }
 
-    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Double &points) {
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointArray &points) {
         PROFILE_SCOPE("RangeImageUtils::projectToRangeImage");
-        const auto size = static_cast<Eigen::Index>(points.x.size());
+        return computeRangeImage<RangeImage>(intrinsics, points);
+    }
 
-        const Eigen::ArrayXd x = Eigen::Map<const Eigen::ArrayXd>(points.x.data(), size);
-        const Eigen::ArrayXd y = Eigen::Map<const Eigen::ArrayXd>(points.y.data(), size);
-        const Eigen::ArrayXd z = Eigen::Map<const Eigen::ArrayXd>(points.z.data(), size);
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<float> &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRaggedRangeImage");
+        return computeRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
 
-        return computeRangeImage(intrinsics, x, y, z);
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<double> &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRaggedRangeImage");
+        return computeRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    RaggedRangeImage projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const StridedCoordinateMaps<float> &points
+    ) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRaggedRangeImage");
+        return computeRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    RaggedRangeImage projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const StridedCoordinateMaps<double> &points
+    ) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRaggedRangeImage");
+        return computeRangeImage<RaggedRangeImage>(intrinsics, points);
+    }
+
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const PointArray &points) {
+        PROFILE_SCOPE("RangeImageUtils::projectToRaggedRangeImage");
+        return computeRangeImage<RaggedRangeImage>(intrinsics, points);
     }
 
     PointCloud::Double unProjectToPointCloud(const Intrinsics &intrinsics, const RangeImage &image) {
-        PointCloud::Double result;
+        return computePointCloud(intrinsics, image);
+    }
+
+    PointCloud::Double unProjectToPointCloud(const Intrinsics &intrinsics, const RaggedRangeImage &image) {
+        return computePointCloud(intrinsics, image);
+    }
+
+    std::optional<QuantizedRangeImage> quantizeRangeImage(const RangeImage &image, const double step) {
         const double *const rangeImageData = image.data();
-        const Scanline* const scanlines = intrinsics.scanlines.data();
+        double minRange = std::numeric_limits<double>::infinity(), maxRange = 0;
 
-        for (int32_t row = 0; row < image.height(); ++row) {
-            const int32_t scanlineIdx = static_cast<int32_t>(image.height()) - row - 1;
-            const Scanline &scanline = scanlines[scanlineIdx];
+        for (uint64_t i = 0; i < image.size(); ++i) {
+            if (rangeImageData[i] > 0) {
+                minRange = std::min(minRange, rangeImageData[i]);
+                maxRange = std::max(maxRange, rangeImageData[i]);
+            }
+        }
 
-            for (int32_t col = 0; col < image.width(); ++col) {
-                const uint32_t flatIdx = row * image.width() + col;
-                const double range = rangeImageData[flatIdx];
+        if (!(step > 0) || !std::isfinite(step) || !std::isfinite(maxRange)) {
+            return std::nullopt;
+        }
 
-                if (range <= 0) {
+        // Code zero marks empty pixels, so the smallest range is stored as code one
+        const double offset = maxRange > 0 ? minRange - step : 0;
+        const double maxCode = std::round((maxRange - offset) / step);
+        if (maxCode > std::numeric_limits<uint32_t>::max()) {
+            return std::nullopt;
+        }
+
+        const auto pixelType = maxCode <= std::numeric_limits<uint16_t>::max() ?
+            QuantizedPixelType::UINT16 : QuantizedPixelType::UINT32;
+        QuantizedRangeImage quantized(image.width(), image.height(), pixelType, step, offset);
+        const double tolerance = quantized.maxRangeError() * (1 + Constant::QUANTIZATION_ERROR_SLACK);
+
+        for (uint32_t row = 0; row < image.height(); ++row) {
+            for (uint32_t col = 0; col < image.width(); ++col) {
+                const double range = image(row, col);
+                if (!(range > 0)) {
                     continue;
                 }
 
-                const double originalPhi = scanline.verticalAngle + scanline.verticalOffset / range;
-                const double rangeXy = range * std::cos(originalPhi);
-                double originalTheta = col * Constant::TWO_PI / image.width() - std::numbers::pi;
-                originalTheta += scanline.horizontalOffset / rangeXy + scanline.azimuthalOffset;
-                originalTheta = Utils::positiveFmod(originalTheta, Constant::TWO_PI);
+                quantized.setCode(row, col, static_cast<uint32_t>(std::round((range - offset) / step)));
 
-                result.x.emplace_back(rangeXy * std::cos(originalTheta));
-                result.y.emplace_back(rangeXy * std::sin(originalTheta));
-                result.z.emplace_back(range * std::sin(originalPhi));
+                // The range is read back from the stored code, so the guarantee holds for what is actually kept
+                if (!(std::abs(quantized.range(row, col) - range) <= tolerance)) {
+                    LOG_WARN("Range ", range, " at (", row, ", ", col, ") cannot be quantized with step ", step);
+                    return std::nullopt;
+                }
             }
         }
 
-        return result;
+        return quantized;
     }
 
-    template<typename Scalar>
-    RangeImage computeRangeImage(
-        const Intrinsics &intrinsics, const Eigen::ArrayX<Scalar> &x, const Eigen::ArrayX<Scalar> &y,
-        const Eigen::ArrayX<Scalar> &z
-    ) {
-        const Eigen::ArrayX<Scalar> rangesXySquared = x.square() + y.square();
-        const Eigen::ArrayX<Scalar> ranges = (rangesXySquared + z.square()).sqrt();
-        const Eigen::ArrayX<Scalar> rangesXy = rangesXySquared.sqrt();
-        const Eigen::ArrayX<Scalar> phis = (z / ranges).asin();
-        const Eigen::ArrayX<Scalar> thetas = y.binaryExpr(x, [](const Scalar yi, const Scalar xi) {
-            return static_cast<Scalar>(std::atan2(yi, xi) + std::numbers::pi);
+    ProjectionGrid::ProjectionGrid(
+        const Intrinsics &intrinsics, const double minRange, const int64_t pointsCount, const bool ragged
+    ) : scanlines(intrinsics.scanlines.data(), intrinsics.scanlines.size()),
+        lookup(scanlines, minRange, pointsCount / Constant::SCANLINE_LOOKUP_POINTS_PER_CELL),
+        height(static_cast<int32_t>(intrinsics.scanlines.size())), rowWidths(height), rowOffsets(height + 1, 0) {
+        // Ragged rows of scanlines without a known resolution are as wide as the finest one
+        const int32_t sharedWidth = ragged ? calculateMaxHorizontalResolution(intrinsics) :
+            calculateLcmHorizontalResolution(intrinsics);
+
+        for (int32_t row = 0; row < height; ++row) {
+            const int32_t resolution = scanlines[height - row - 1].resolution;
+            rowWidths[row] = ragged && resolution > 0 ? resolution : sharedWidth;
+            rowOffsets[row + 1] = rowOffsets[row] + static_cast<int32_t>(rowWidths[row]);
+        }
+    }
+
+    template<typename Image, typename Scalar, typename Stride>
+    Image computeRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<Scalar, Stride> &points) {
+        const auto &x = points.x, &y = points.y, &z = points.z;
+        const Eigen::Index pointsCount = x.size();
+        const int64_t count = blocksCount(pointsCount);
+
+        // The smallest range only bounds the lookup grid, so a cheap pass over the squared ranges is enough
+        std::vector<Scalar> blockMinSquaredRanges(count);
+        Parallel::parallelFor(0, count, [&](const int64_t block) {
+            const int64_t begin = block * PROJECTION_BLOCK_SIZE;
+            const int64_t blockSize = std::min(PROJECTION_BLOCK_SIZE, pointsCount - begin);
+            blockMinSquaredRanges[block] = (x.segment(begin, blockSize).square() +
+                y.segment(begin, blockSize).square() + z.segment(begin, blockSize).square()).minCoeff();
         });
-        Eigen::ArrayXd correctedThetas(phis.size());
-        Eigen::ArrayXi scanlinesByPoints(phis.size());
 
-        const Scanline* const scanlinesData = intrinsics.scanlines.data();
-        const uint64_t scanlinesCount = intrinsics.scanlines.size();
-        const std::span scanlines(scanlinesData, scanlinesCount);
+        const double minSquaredRange = count > 0 ? *std::ranges::min_element(blockMinSquaredRanges) : 0;
+        const ProjectionGrid grid(
+            intrinsics, std::sqrt(minSquaredRange), pointsCount, std::is_same_v<Image, RaggedRangeImage>
+        );
+
+        Eigen::ArrayX<Scalar> ranges(pointsCount);
+        Eigen::ArrayXi flatIndices(pointsCount);
+
+        // Each block derives its fields, scanlines and pixels while they are in cache. Blocks start at multiples of
+        // the packet size, so the vectorized kernels give the same results as over the whole arrays
+        Parallel::parallelFor(0, count, [&](const int64_t block) {
+            const int64_t begin = block * PROJECTION_BLOCK_SIZE;
+            const int64_t blockSize = std::min(PROJECTION_BLOCK_SIZE, pointsCount - begin);
+            const auto blockX = x.segment(begin, blockSize), blockY = y.segment(begin, blockSize);
+            const auto blockZ = z.segment(begin, blockSize);
+            auto blockRanges = ranges.segment(begin, blockSize);
+
+            // Square roots run over contiguous arrays only, so that strided input takes the same packet path. With
+            // EIGEN_FAST_MATH the float packet square root is approximate, and would otherwise depend on the layout
+            const Eigen::ArrayX<Scalar> rangesXySquared = blockX.square() + blockY.square();
+            blockRanges = rangesXySquared + blockZ.square();
+            blockRanges = blockRanges.sqrt();
+            const Eigen::ArrayX<Scalar> rangesXy = rangesXySquared.sqrt();
+            Eigen::ArrayX<Scalar> phis = blockZ / blockRanges;
+            Eigen::ArrayX<Scalar> thetas(blockSize);
+
+            if constexpr (std::is_same_v<Scalar, double>) {
+                FastMath::asin(phis, phis);
+                FastMath::atan2(blockY, blockX, thetas);
+            } else {
+                phis = phis.asin();
+                thetas = blockY.binaryExpr(blockX, [](const Scalar yi, const Scalar xi) {
+                    return std::atan2(yi, xi);
+                });
+            }
 
-        for (int32_t pointIdx = 0; pointIdx < phis.size(); ++pointIdx) {
-            const int32_t bestScanlineIdx = findBestScanline(scanlines, ranges, phis, pointIdx);
+            computeBlockPixels(
+                grid, points, begin, blockRanges, rangesXy, phis, thetas, flatIndices.segment(begin, blockSize)
+            );
+        });
 
-            scanlinesByPoints(pointIdx) = bestScanlineIdx;
-            const double hOffset = scanlines[bestScanlineIdx].horizontalOffset;
-            const double thetaOffset = scanlines[bestScanlineIdx].azimuthalOffset;
-            correctedThetas(pointIdx) = thetas(pointIdx) - hOffset / rangesXy(pointIdx) - thetaOffset;
-        }
+        return scatterPixels<Image>(grid, ranges, flatIndices);
+    }
 
-        Utils::positiveFmodInplace(correctedThetas, Constant::TWO_PI);
+    template<typename Image>
+    Image computeRangeImage(const Intrinsics &intrinsics, const PointArray &points) {
+        const auto size = static_cast<Eigen::Index>(points.size());
+        const CoordinateMaps<double> coordinates{
+            {points.getX().data(), size}, {points.getY().data(), size}, {points.getZ().data(), size}
+        };
+
+        // The point array derives its fields with the same kernels as the double path, so the image is identical.
+        // They are read in place, so a prepared cloud keeps them for later calls
+        const Eigen::ArrayXd &ranges = points.getRanges();
+        const Eigen::ArrayXd &rangesXy = points.getRangesXy();
+        const Eigen::ArrayXd &phis = points.getPhis();
+        const Eigen::ArrayXd &thetas = points.getThetas();
+
+        const ProjectionGrid grid(intrinsics, points.getMinRange(), size, std::is_same_v<Image, RaggedRangeImage>);
+        Eigen::ArrayXi flatIndices(size);
+
+        Parallel::parallelFor(0, blocksCount(size), [&](const int64_t block) {
+            const int64_t begin = block * PROJECTION_BLOCK_SIZE;
+            const int64_t blockSize = std::min(PROJECTION_BLOCK_SIZE, size - begin);
+
+            computeBlockPixels(
+                grid, coordinates, begin, ranges.segment(begin, blockSize), rangesXy.segment(begin, blockSize),
+                phis.segment(begin, blockSize), thetas.segment(begin, blockSize), flatIndices.segment(begin, blockSize)
+            );
+        });
 
-        return buildProjection(intrinsics, scanlinesByPoints, ranges, correctedThetas);
+        return scatterPixels<Image>(grid, ranges, flatIndices);
     }
 
-    template<typename Scalar>
-    int32_t findBestScanline(
-        const std::span<Scanline const> scanlines, const Eigen::ArrayX<Scalar> &ranges,
-        const Eigen::ArrayX<Scalar> &phis, const int32_t pointIdx
+    template<typename Scalar, typename Stride>
+    void computeBlockPixels(
+        const ProjectionGrid &grid, const CoordinateMaps<Scalar, Stride> &points, const Eigen::Index begin,
+        const BlockFields<Scalar> &ranges, const BlockFields<Scalar> &rangesXy, const BlockFields<Scalar> &phis,
+        const BlockFields<Scalar> &thetas, Eigen::Ref<Eigen::ArrayXi> flatIndices
     ) {
-        double minPhiDiff = std::numeric_limits<double>::max();
-        int32_t bestScanlineIdx = -1;
-
-        for (int32_t laserIdx = 0; laserIdx < scanlines.size(); ++laserIdx) {
-            const double vOffset = scanlines[laserIdx].verticalOffset;
-            const double vAngle = scanlines[laserIdx].verticalAngle;
-
-            const double phiCorrection = vOffset / ranges(pointIdx);
-            const double phiDiff = std::abs(phis(pointIdx) - phiCorrection - vAngle);
+        const auto &x = points.x, &y = points.y, &z = points.z;
+        // Double angles come from the fast kernels, float ones from libm
+        constexpr bool fastMath = std::is_same_v<Scalar, double>;
+        // Largest change of a phi difference, or of a theta, between the fast kernels and libm. It adds the rounding
+        // of the subsequent arithmetic, which may differ on both paths
+        constexpr double epsilon = std::numeric_limits<double>::epsilon();
+        constexpr double phiDiffGuard = 2 * (FastMath::ASIN_MAX_ABS_ERROR + 8 * epsilon);
+        constexpr double thetaGuard = 2 * FastMath::ATAN2_MAX_ABS_ERROR;
+
+        for (Eigen::Index i = 0; i < phis.size(); ++i) {
+            const Eigen::Index pointIdx = begin + i;
+            const double range = ranges(i);
+            Scalar phi = phis(i);
+            // Thetas are atan2 results, shifted to [0, 2pi] here and rounded to the scalar as the float path always was
+            Scalar theta = static_cast<Scalar>(thetas(i) + std::numbers::pi);
+
+            double phiDiffMargin;
+            int32_t bestScanlineIdx = grid.lookup.findBestScanline(range, phi, phiDiffMargin);
+
+            if constexpr (fastMath) {
+                // The kernel error could change the choice, so the point is resolved as with libm
+                if (phiDiffMargin <= phiDiffGuard) {
+                    phi = std::asin(z(pointIdx) / ranges(i));
+                    bestScanlineIdx = grid.lookup.findBestScanline(range, phi, phiDiffMargin);
+                }
+            }
 
-            if (phiDiff < minPhiDiff) {
-                minPhiDiff = phiDiff;
-                bestScanlineIdx = laserIdx;
+            const int32_t row = grid.height - bestScanlineIdx - 1;
+            const auto width = static_cast<int32_t>(grid.rowWidths[row]);
+            const double hOffset = grid.scanlines[bestScanlineIdx].horizontalOffset;
+            const double thetaOffset = grid.scanlines[bestScanlineIdx].azimuthalOffset;
+            const auto columnOf = [&](const double value) {
+                const double correctedTheta = value - hOffset / rangesXy(i) - thetaOffset;
+                return thetaToColumn(Utils::positiveFmod(correctedTheta, Constant::TWO_PI), width);
+            };
+
+            if constexpr (fastMath) {
+                // The column is monotonic in theta, so it is exact if both ends of the error interval agree
+                if (columnOf(theta - thetaGuard) != columnOf(theta + thetaGuard)) {
+                    theta = std::atan2(y(pointIdx), x(pointIdx)) + std::numbers::pi;
+                }
             }
-        }
 
-        return bestScanlineIdx;
+            flatIndices(i) = grid.rowOffsets[row] + columnOf(theta);
+        }
     }
 
-    template<typename Scalar>
-    RangeImage buildProjection(
-        const Intrinsics &intrinsics, const Eigen::ArrayXi &scanlinesByPoints, const Eigen::ArrayX<Scalar> &ranges,
-        const Eigen::ArrayXd &correctedThetas
+    // Pixels are written serially in input order, so that the last of several points sharing a pixel is kept
+    template<typename Image, typename Scalar>
+    Image scatterPixels(
+        const ProjectionGrid &grid, const Eigen::ArrayX<Scalar> &ranges, const Eigen::ArrayXi &flatIndices
     ) {
-        const int32_t width = calculateLcmHorizontalResolution(intrinsics);
-        const int32_t height = static_cast<int32_t>(intrinsics.scanlines.size());
-        RangeImage rangeImage(width, height, 0);
+        Image rangeImage;
+        if constexpr (std::is_same_v<Image, RaggedRangeImage>) {
+            rangeImage = RaggedRangeImage(grid.rowWidths.data(), grid.height, 0);
+        } else {
+            rangeImage = RangeImage(grid.height > 0 ? grid.rowWidths[0] : 0, grid.height, 0);
+        }
         double *rangeImageData = rangeImage.data();
 
-        for (int32_t pointIdx = 0; pointIdx < ranges.size(); ++pointIdx) {
-            const int32_t row = height - scanlinesByPoints(pointIdx) - 1;
-            const double normalizedTheta =  correctedThetas(pointIdx) / (2 * std::numbers::pi);
-            auto col = static_cast<int32_t>(std::round(normalizedTheta * width));
-
-            col = col < 0 ? width - col : col;
-            col = col >= width ? col - width : col;
-
-            const int32_t flatIdx = row * width + col;
+        for (Eigen::Index pointIdx = 0; pointIdx < ranges.size(); ++pointIdx) {
+            const int32_t flatIdx = flatIndices(pointIdx);
 
             if (rangeImageData[flatIdx] != 0) {
-                LOG_WARN("Overwriting pixel at (", row, ", ", col, ") with range ", ranges(pointIdx),
-                         " (previously: ", rangeImage(row, col), "). Losslessness not achieved!");
+                const auto row = std::ranges::upper_bound(grid.rowOffsets, flatIdx) - grid.rowOffsets.begin() - 1;
+                LOG_WARN("Overwriting pixel at (", row, ", ", flatIdx - grid.rowOffsets[row], ") with range ",
+                         ranges(pointIdx), " (previously: ", rangeImageData[flatIdx], "). Losslessness not achieved!");
             }
 
             rangeImageData[flatIdx] = ranges(pointIdx);
@@ -171,6 +366,71 @@ namespace alice_lri::RangeImageUtils {
         return rangeImage;
     }
 
+    // Unprojection keeps libm: its output is compared against the original points, so the error bound of the fast
+    // kernels would add up to every coordinate and could not be guarded per pixel as in projection
+    template<typename Image>
+    PointCloud::Double computePointCloud(const Intrinsics &intrinsics, const Image &image) {
+        PointCloud::Double result;
+        const Scanline* const scanlines = intrinsics.scanlines.data();
+
+        for (uint32_t row = 0; row < image.height(); ++row) {
+            const uint32_t scanlineIdx = image.height() - row - 1;
+            const Scanline &scanline = scanlines[scanlineIdx];
+            const uint32_t width = rowWidth(image, row);
+            const double *const rowData = image.data() + rowOffset(image, row);
+
+            for (uint32_t col = 0; col < width; ++col) {
+                const double range = rowData[col];
+
+                if (range <= 0) {
+                    continue;
+                }
+
+                const double originalPhi = scanline.verticalAngle + scanline.verticalOffset / range;
+                const double rangeXy = range * std::cos(originalPhi);
+                double originalTheta = col * Constant::TWO_PI / width - std::numbers::pi;
+                originalTheta += scanline.horizontalOffset / rangeXy + scanline.azimuthalOffset;
+                originalTheta = Utils::positiveFmod(originalTheta, Constant::TWO_PI);
+
+                result.x.emplace_back(rangeXy * std::cos(originalTheta));
+                result.y.emplace_back(rangeXy * std::sin(originalTheta));
+                result.z.emplace_back(range * std::sin(originalPhi));
+            }
+        }
+
+        return result;
+    }
+
+    int64_t blocksCount(const int64_t pointsCount) {
+        return (pointsCount + PROJECTION_BLOCK_SIZE - 1) / PROJECTION_BLOCK_SIZE;
+    }
+
+    inline uint32_t rowWidth(const RangeImage &image, uint32_t) {
+        return image.width();
+    }
+
+    inline uint32_t rowWidth(const RaggedRangeImage &image, const uint32_t row) {
+        return image.rowWidth(row);
+    }
+
+    inline uint64_t rowOffset(const RangeImage &image, const uint32_t row) {
+        return static_cast<uint64_t>(row) * image.width();
+    }
+
+    inline uint64_t rowOffset(const RaggedRangeImage &image, const uint32_t row) {
+        return image.rowOffset(row);
+    }
+
+    inline int32_t thetaToColumn(const double correctedTheta, const int32_t width) {
+        const double normalizedTheta =  correctedTheta / (2 * std::numbers::pi);
+        auto col = static_cast<int32_t>(std::round(normalizedTheta * width));
+
+        col = col < 0 ? width - col : col;
+        col = col >= width ? col - width : col;
+
+        return col;
+    }
+
     inline int32_t calculateLcmHorizontalResolution(const Intrinsics &intrinsics) {
         int32_t result = 1;
         for (const auto & scanline : intrinsics.scanlines) {
@@ -182,4 +442,13 @@ namespace alice_lri::RangeImageUtils {
 
         return result;
     }
+
+    inline int32_t calculateMaxHorizontalResolution(const Intrinsics &intrinsics) {
+        int32_t result = 1;
+        for (const auto & scanline : intrinsics.scanlines) {
+            result = std::max(result, scanline.resolution);
+        }
+
+        return result;
+    }
 }
@@ -1,9 +1,29 @@
 #pragma once
+#include <optional>
 #include "alice_lri/Structs.hpp"
+#include "point/CoordinateMaps.h"
+#include "point/PointArray.h"
 
 namespace alice_lri::RangeImageUtils {
-    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Float &points);
-    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointCloud::Double &points);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<float> &points);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<double> &points);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const StridedCoordinateMaps<float> &points);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const StridedCoordinateMaps<double> &points);
+    RangeImage projectToRangeImage(const Intrinsics &intrinsics, const PointArray &points);
+
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<float> &points);
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const CoordinateMaps<double> &points);
+    RaggedRangeImage projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const StridedCoordinateMaps<float> &points
+    );
+    RaggedRangeImage projectToRaggedRangeImage(
+        const Intrinsics &intrinsics, const StridedCoordinateMaps<double> &points
+    );
+    RaggedRangeImage projectToRaggedRangeImage(const Intrinsics &intrinsics, const PointArray &points);
 
     PointCloud::Double unProjectToPointCloud(const Intrinsics &intrinsics, const RangeImage &image);
+    PointCloud::Double unProjectToPointCloud(const Intrinsics &intrinsics, const RaggedRangeImage &image);
+
+    // Stores the ranges as codes of the given step, or nothing if a stored range is not within half a step
+    std::optional<QuantizedRangeImage> quantizeRangeImage(const RangeImage &image, double step);
 }
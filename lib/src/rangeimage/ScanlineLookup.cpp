@@ -0,0 +1,154 @@
+#include "ScanlineLookup.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ranges>
+#include "Constants.h"
+
+// Absolute tolerance on phi differences, far above the rounding of their evaluation, which keeps every scanline that
+// could be best or second best once rounded as a candidate
+constexpr double CANDIDATE_SLACK = 1e-9;
+
+namespace alice_lri {
+    ScanlineLookup::ScanlineLookup(
+        const std::span<const Scanline> scanlines, const double minRange, const uint64_t maxCells
+    ) : scanlines(scanlines) {
+        // With two scanlines or less both are always candidates, so the grid would not save anything
+        if (scanlines.size() > 2 && minRange > 0 && std::isfinite(1 / minRange) && maxCells > 0) {
+            buildGrid(1 / minRange, maxCells);
+        }
+    }
+
+    int32_t ScanlineLookup::findBestScanline(const double range, const double phi, double &phiDiffMargin) const {
+        if (!cellOffsets.empty()) {
+            const double invRangePosition = 1 / range / invRangeStep;
+            const double phiPosition = (phi - phiMin) / phiStep;
+
+            // Written so that NaN positions fail as well
+            if (invRangePosition >= 0 && invRangePosition < invRangeBins && phiPosition >= 0 && phiPosition < phiBins) {
+                const int64_t cell = static_cast<int64_t>(invRangePosition) * phiBins +
+                    static_cast<int64_t>(phiPosition);
+                const std::span cellCandidates(
+                    candidates.data() + cellOffsets[cell], cellOffsets[cell + 1] - cellOffsets[cell]
+                );
+                return evaluate(cellCandidates, range, phi, phiDiffMargin);
+            }
+        }
+
+        const auto scanlinesCount = static_cast<int32_t>(scanlines.size());
+        return evaluate(std::views::iota(0, scanlinesCount), range, phi, phiDiffMargin);
+    }
+
+    void ScanlineLookup::buildGrid(const double maxInvRange, const uint64_t maxCells) {
+        double lowestPhi = std::numeric_limits<double>::infinity(), highestPhi = -lowestPhi;
+        double minOffset = std::numeric_limits<double>::infinity(), maxOffset = -minOffset;
+
+        for (const Scanline &scanline: scanlines) {
+            const double nearPhi = scanline.verticalAngle + scanline.verticalOffset * maxInvRange;
+            lowestPhi = std::min({lowestPhi, scanline.verticalAngle, nearPhi});
+            highestPhi = std::max({highestPhi, scanline.verticalAngle, nearPhi});
+            minOffset = std::min(minOffset, scanline.verticalOffset);
+            maxOffset = std::max(maxOffset, scanline.verticalOffset);
+        }
+
+        const auto scanlinesCount = static_cast<double>(scanlines.size());
+        const double meanGap = (highestPhi - lowestPhi) / scanlinesCount;
+        if (!(meanGap > 0) || !std::isfinite(meanGap)) {
+            return;
+        }
+
+        // The grid extends one mean gap beyond the outermost scanlines, where points still have a nearby candidate
+        phiMin = lowestPhi - meanGap;
+        const double phiMax = highestPhi + meanGap;
+
+        // Inverse range cells are sized so that the relative drift of two scanlines across a cell is below one phi cell
+        const double wantedPhiBins = Constant::SCANLINE_LOOKUP_PHI_BINS_PER_GAP * (scanlinesCount + 2);
+        const double wantedInvRangeBins = std::clamp(
+            std::ceil(Constant::SCANLINE_LOOKUP_PHI_BINS_PER_GAP * (maxOffset - minOffset) * maxInvRange / meanGap),
+            1.0, static_cast<double>(Constant::SCANLINE_LOOKUP_MAX_INV_RANGE_BINS)
+        );
+        const double wantedCells = wantedPhiBins * wantedInvRangeBins;
+        const double scale = std::sqrt(std::min(1.0, static_cast<double>(maxCells) / wantedCells));
+
+        phiBins = std::max(1, static_cast<int32_t>(wantedPhiBins * scale));
+        invRangeBins = std::max(1, static_cast<int32_t>(wantedInvRangeBins * scale));
+        phiStep = (phiMax - phiMin) / phiBins;
+        invRangeStep = maxInvRange / invRangeBins;
+
+        std::vector<double> lowerBounds(scanlines.size());
+        cellOffsets.reserve(static_cast<size_t>(invRangeBins) * phiBins + 1);
+        cellOffsets.emplace_back(0);
+
+        for (int32_t invRangeBin = 0; invRangeBin < invRangeBins; ++invRangeBin) {
+            for (int32_t phiBin = 0; phiBin < phiBins; ++phiBin) {
+                addCellCandidates(
+                    invRangeBin * invRangeStep, (invRangeBin + 1) * invRangeStep,
+                    phiMin + phiBin * phiStep, phiMin + (phiBin + 1) * phiStep, lowerBounds
+                );
+                cellOffsets.emplace_back(static_cast<uint32_t>(candidates.size()));
+            }
+        }
+    }
+
+    void ScanlineLookup::addCellCandidates(
+        const double invRange0, const double invRange1, const double phi0, const double phi1,
+        std::vector<double> &lowerBounds
+    ) {
+        double bestUpperBound = std::numeric_limits<double>::infinity();
+        double secondUpperBound = std::numeric_limits<double>::infinity();
+
+        // The phi difference is linear in phi and in the inverse range, so its extremes over the cell are at corners
+        for (size_t i = 0; i < scanlines.size(); ++i) {
+            const Scanline &scanline = scanlines[i];
+            const double correction0 = scanline.verticalOffset * invRange0;
+            const double correction1 = scanline.verticalOffset * invRange1;
+            const double minDiff = phi0 - scanline.verticalAngle - std::max(correction0, correction1);
+            const double maxDiff = phi1 - scanline.verticalAngle - std::min(correction0, correction1);
+
+            lowerBounds[i] = minDiff > 0 ? minDiff : maxDiff < 0 ? -maxDiff : 0;
+            const double upperBound = std::max(-minDiff, maxDiff);
+
+            if (upperBound < bestUpperBound) {
+                secondUpperBound = bestUpperBound;
+                bestUpperBound = upperBound;
+            } else if (upperBound < secondUpperBound) {
+                secondUpperBound = upperBound;
+            }
+        }
+
+        // A scanline that two others beat everywhere in the cell is neither the best nor the second best
+        for (size_t i = 0; i < scanlines.size(); ++i) {
+            if (lowerBounds[i] <= secondUpperBound + CANDIDATE_SLACK) {
+                candidates.emplace_back(static_cast<int32_t>(i));
+            }
+        }
+    }
+
+    template<typename Indices>
+    int32_t ScanlineLookup::evaluate(
+        const Indices &indices, const double range, const double phi, double &phiDiffMargin
+    ) const {
+        double minPhiDiff = std::numeric_limits<double>::max();
+        double secondPhiDiff = std::numeric_limits<double>::max();
+        int32_t bestScanlineIdx = -1;
+
+        for (const int32_t laserIdx: indices) {
+            const double vOffset = scanlines[laserIdx].verticalOffset;
+            const double vAngle = scanlines[laserIdx].verticalAngle;
+
+            const double phiCorrection = vOffset / range;
+            const double phiDiff = std::abs(phi - phiCorrection - vAngle);
+
+            if (phiDiff < minPhiDiff) {
+                secondPhiDiff = minPhiDiff;
+                minPhiDiff = phiDiff;
+                bestScanlineIdx = laserIdx;
+            } else if (phiDiff < secondPhiDiff) {
+                secondPhiDiff = phiDiff;
+            }
+        }
+
+        phiDiffMargin = secondPhiDiff - minPhiDiff;
+        return bestScanlineIdx;
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "alice_lri/Structs.hpp"
+
+namespace alice_lri {
+    // Finds the scanline whose vertical angle, corrected by its offset, is closest to a point's phi. A grid over
+    // (1 / range, phi) stores the scanlines that can be the best or second best match anywhere in each cell, so that
+    // only those are evaluated. The evaluation itself, including ties and the margin, is the same as a full scan
+    class ScanlineLookup {
+    public:
+        // The grid covers ranges down to minRange, with at most maxCells cells. Points outside it are fully scanned
+        ScanlineLookup(std::span<const Scanline> scanlines, double minRange, uint64_t maxCells);
+
+        // Index of the best scanline, with the gap between the second best and best phi differences in phiDiffMargin
+        int32_t findBestScanline(double range, double phi, double &phiDiffMargin) const;
+
+    private:
+        std::span<const Scanline> scanlines;
+        int32_t invRangeBins = 0, phiBins = 0;
+        double invRangeStep = 0, phiMin = 0, phiStep = 0;
+        // Candidates of each cell, ascending, in candidates[cellOffsets[cell]:cellOffsets[cell + 1]]
+        std::vector<uint32_t> cellOffsets;
+        std::vector<int32_t> candidates;
+
+        void buildGrid(double maxInvRange, uint64_t maxCells);
+        void addCellCandidates(
+            double invRange0, double invRange1, double phi0, double phi1, std::vector<double> &lowerBounds
+        );
+
+        template<typename Indices>
+        int32_t evaluate(const Indices &indices, double range, double phi, double &phiDiffMargin) const;
+    };
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BuildOptions.h"
+
+namespace alice_lri::Parallel {
+    namespace detail {
+        inline thread_local bool insideParallelRegion = false;
+    }
+
+    inline uint32_t threadCount() {
+        if constexpr (!BuildOptions::USE_MULTITHREADING) {
+            return 1;
+        }
+
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // Calls function(i) for every i in [begin, end), handing out blocks of grainSize indices dynamically. The function
+    // must only write to per-index state. Nested calls run serially in the calling thread.
+    template <typename Function>
+    void parallelFor(const int64_t begin, const int64_t end, const Function &function, const int64_t grainSize = 1) {
+        const int64_t count = end - begin;
+        if (count <= 0) {
+            return;
+        }
+
+        const int64_t blocksCount = (count + grainSize - 1) / grainSize;
+        const auto workersCount = static_cast<int64_t>(std::min<uint64_t>(threadCount(), blocksCount));
+
+        if (workersCount <= 1 || detail::insideParallelRegion) {
+            for (int64_t i = begin; i < end; ++i) {
+                function(i);
+            }
+
+            return;
+        }
+
+        std::atomic<int64_t> nextBlock = 0;
+        std::exception_ptr exception = nullptr;
+        std::mutex exceptionMutex;
+
+        auto worker = [&]() {
+            detail::insideParallelRegion = true;
+
+            try {
+                for (int64_t block = nextBlock++; block < blocksCount; block = nextBlock++) {
+                    const int64_t blockBegin = begin + block * grainSize;
+                    const int64_t blockEnd = std::min(blockBegin + grainSize, end);
+
+                    for (int64_t i = blockBegin; i < blockEnd; ++i) {
+                        function(i);
+                    }
+                }
+            } catch (...) {
+                std::lock_guard lock(exceptionMutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+
+                nextBlock = blocksCount;
+            }
+
+            detail::insideParallelRegion = false;
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workersCount - 1);
+        for (int64_t t = 1; t < workersCount; ++t) {
+            threads.emplace_back(worker);
+        }
+
+        worker();
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
@@ -2,6 +2,7 @@
 #include <chrono>
 #include <iostream>
 #include <map>
+#include <mutex>
 
 #include "logger/Logger.h"
 
@@ -27,7 +28,10 @@ public:
     ~Timer() {
         auto end = std::chrono::high_resolution_clock::now();
         std::chrono::duration<double> duration = end - start;
-        getTotalTimeMap()[std::string(name)] += duration.count();
+        {
+            std::lock_guard lock(getTotalTimeMutex());
+            getTotalTimeMap()[std::string(name)] += duration.count();
+        }
         LOG_DEBUG("[TIMER] ", std::string(name), " took ", duration.count(), " seconds");
     }
 
@@ -48,5 +52,10 @@ private:
         static std::unordered_map<std::string, double> totalTimeMap;
         return totalTimeMap;
     }
+
+    static std::mutex& getTotalTimeMutex() {
+        static std::mutex totalTimeMutex;
+        return totalTimeMutex;
+    }
 };
 #endif
\ No newline at end of file
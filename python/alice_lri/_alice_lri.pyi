@@ -6,7 +6,7 @@ import collections.abc
 import numpy
 import numpy.typing
 import typing
-__all__: list[str] = ['ALL_ASSIGNED', 'EMPTY_POINT_CLOUD', 'EndReason', 'ErrorCode', 'INTERNAL_ERROR', 'Interval', 'Intrinsics', 'IntrinsicsDetailed', 'MAX_ITERATIONS', 'MISMATCHED_SIZES', 'NONE', 'NO_MORE_PEAKS', 'RANGES_XY_ZERO', 'RangeImage', 'Scanline', 'ScanlineAngleBounds', 'ScanlineDetailed', 'ValueConfInterval', 'error_message', 'estimate_intrinsics', 'estimate_intrinsics_detailed', 'intrinsics_from_json_file', 'intrinsics_from_json_str', 'intrinsics_to_json_file', 'intrinsics_to_json_str', 'project_to_range_image', 'unproject_to_point_cloud']
+__all__: list[str] = ['ALL_ASSIGNED', 'EMPTY_POINT_CLOUD', 'EndReason', 'ErrorCode', 'FILE_ERROR', 'INTERNAL_ERROR', 'INVALID_FILE_FORMAT', 'INVALID_LAYOUT', 'Interval', 'Intrinsics', 'IntrinsicsDetailed', 'MAX_ITERATIONS', 'MISMATCHED_SIZES', 'NONE', 'NO_MORE_PEAKS', 'QUANTIZATION_ERROR', 'QuantizedPixelType', 'QuantizedRangeImage', 'RANGES_XY_ZERO', 'RaggedRangeImage', 'RangeImage', 'Scanline', 'ScanlineAngleBounds', 'ScanlineDetailed', 'UINT16', 'UINT32', 'ValueConfInterval', 'error_message', 'estimate_intrinsics', 'estimate_intrinsics_detailed', 'estimate_intrinsics_from_records', 'intrinsics_from_json_file', 'intrinsics_from_json_str', 'intrinsics_to_json_file', 'intrinsics_to_json_str', 'project_records_to_ragged_range_image', 'project_records_to_range_image', 'project_to_quantized_range_image', 'project_to_ragged_range_image', 'project_to_range_image', 'unproject_to_point_cloud']
 class EndReason:
     """
     
@@ -68,13 +68,25 @@ class ErrorCode:
       RANGES_XY_ZERO : At least one point has a range of zero in the XY plane.
     
       INTERNAL_ERROR : Internal error occurred.
+    
+      INVALID_LAYOUT : Strided point records are misaligned or their coordinates exceed the stride.
+    
+      FILE_ERROR : Point cloud file cannot be opened or mapped.
+    
+      INVALID_FILE_FORMAT : Point cloud file is malformed or its format is not supported.
+    
+      QUANTIZATION_ERROR : Ranges cannot be stored as fixed-point codes within the round-trip error bound.
     """
     EMPTY_POINT_CLOUD: typing.ClassVar[ErrorCode]  # value = <ErrorCode.EMPTY_POINT_CLOUD: 2>
+    FILE_ERROR: typing.ClassVar[ErrorCode]  # value = <ErrorCode.FILE_ERROR: 6>
     INTERNAL_ERROR: typing.ClassVar[ErrorCode]  # value = <ErrorCode.INTERNAL_ERROR: 4>
+    INVALID_FILE_FORMAT: typing.ClassVar[ErrorCode]  # value = <ErrorCode.INVALID_FILE_FORMAT: 7>
+    INVALID_LAYOUT: typing.ClassVar[ErrorCode]  # value = <ErrorCode.INVALID_LAYOUT: 5>
     MISMATCHED_SIZES: typing.ClassVar[ErrorCode]  # value = <ErrorCode.MISMATCHED_SIZES: 1>
     NONE: typing.ClassVar[ErrorCode]  # value = <ErrorCode.NONE: 0>
+    QUANTIZATION_ERROR: typing.ClassVar[ErrorCode]  # value = <ErrorCode.QUANTIZATION_ERROR: 8>
     RANGES_XY_ZERO: typing.ClassVar[ErrorCode]  # value = <ErrorCode.RANGES_XY_ZERO: 3>
-    __members__: typing.ClassVar[dict[str, ErrorCode]]  # value = {'NONE': <ErrorCode.NONE: 0>, 'MISMATCHED_SIZES': <ErrorCode.MISMATCHED_SIZES: 1>, 'EMPTY_POINT_CLOUD': <ErrorCode.EMPTY_POINT_CLOUD: 2>, 'RANGES_XY_ZERO': <ErrorCode.RANGES_XY_ZERO: 3>, 'INTERNAL_ERROR': <ErrorCode.INTERNAL_ERROR: 4>}
+    __members__: typing.ClassVar[dict[str, ErrorCode]]  # value = {'NONE': <ErrorCode.NONE: 0>, 'MISMATCHED_SIZES': <ErrorCode.MISMATCHED_SIZES: 1>, 'EMPTY_POINT_CLOUD': <ErrorCode.EMPTY_POINT_CLOUD: 2>, 'RANGES_XY_ZERO': <ErrorCode.RANGES_XY_ZERO: 3>, 'INTERNAL_ERROR': <ErrorCode.INTERNAL_ERROR: 4>, 'INVALID_LAYOUT': <ErrorCode.INVALID_LAYOUT: 5>, 'FILE_ERROR': <ErrorCode.FILE_ERROR: 6>, 'INVALID_FILE_FORMAT': <ErrorCode.INVALID_FILE_FORMAT: 7>, 'QUANTIZATION_ERROR': <ErrorCode.QUANTIZATION_ERROR: 8>}
     def __eq__(self, other: typing.Any) -> bool:
         ...
     def __getstate__(self) -> int:
@@ -223,6 +235,206 @@ class IntrinsicsDetailed:
     @vertical_iterations.setter
     def vertical_iterations(self, arg0: typing.SupportsInt) -> None:
         ...
+class QuantizedPixelType:
+    """
+    
+            Integer type of the pixels of a QuantizedRangeImage.
+        
+    
+    Members:
+    
+      UINT16 : 16-bit unsigned pixels.
+    
+      UINT32 : 32-bit unsigned pixels.
+    """
+    UINT16: typing.ClassVar[QuantizedPixelType]  # value = <QuantizedPixelType.UINT16: 0>
+    UINT32: typing.ClassVar[QuantizedPixelType]  # value = <QuantizedPixelType.UINT32: 1>
+    __members__: typing.ClassVar[dict[str, QuantizedPixelType]]  # value = {'UINT16': <QuantizedPixelType.UINT16: 0>, 'UINT32': <QuantizedPixelType.UINT32: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: typing.SupportsInt) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: typing.SupportsInt) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
+class QuantizedRangeImage:
+    """
+    
+            Range image with fixed-point pixels, laid out like RangeImage.
+    
+            A pixel stores an integer code, with zero for empty pixels. Its range is offset + code * scale, within
+            max_range_error of the projected range. The pixels are 16-bit when the codes fit, and 32-bit otherwise.
+        
+    """
+    def __array__(self, **kwargs) -> numpy.ndarray:
+        """
+                    Convert the pixel codes to a NumPy array (zero-copy view).
+        
+                    Returns:
+                        numpy.ndarray: A 2D uint16 or uint32 array view of the codes, with zero for empty pixels.
+        
+                    Example:
+                        >>> import numpy as np
+                        >>> codes = np.asarray(range_image)
+                        >>> ranges = np.where(codes > 0, range_image.offset + codes * range_image.scale, 0)
+        """
+    def __getitem__(self, arg0: tuple) -> float:
+        """
+                    Get the range stored at the specified position.
+        
+                    Args:
+                        row (int): Row index (0 to height-1).
+                        col (int): Column index (0 to width-1).
+                    Returns:
+                        float: Range at [row, col], zero if empty.
+        """
+    def __init__(self) -> None:
+        """
+        Default constructor (empty image).
+        """
+    def __repr__(self) -> str:
+        ...
+    def to_range_image(self) -> RangeImage:
+        """
+        Restore the ranges into a RangeImage, with zero for empty pixels.
+        """
+    @property
+    def height(self) -> int:
+        """
+        Image height.
+        """
+    @property
+    def max_range_error(self) -> float:
+        """
+        Largest difference between a stored range and the projected one.
+        """
+    @property
+    def offset(self) -> float:
+        """
+        Range of code zero.
+        """
+    @property
+    def pixel_type(self) -> QuantizedPixelType:
+        """
+        Pixel type.
+        """
+    @property
+    def scale(self) -> float:
+        """
+        Range step of one code.
+        """
+    @property
+    def width(self) -> int:
+        """
+        Image width.
+        """
+class RaggedRangeImage:
+    """
+    
+            Range image whose rows are as wide as the horizontal resolution of their scanlines.
+    
+            Rows are stored back to back, so the number of pixels is the sum of the row widths instead of the height
+            times the least common multiple of the resolutions.
+    
+            Args:
+                row_widths (list of int): Width of each row.
+                initial_value (float): Initial value for all pixels.
+        
+    """
+    def __array__(self, **kwargs) -> numpy.typing.NDArray[numpy.float64]:
+        """
+                    Convert RaggedRangeImage to a flat NumPy array with all rows back to back (zero-copy view).
+        
+                    Returns:
+                        numpy.ndarray: A 1D array view of the pixel data. Row r is array[row_offsets[r]:row_offsets[r + 1]].
+        
+                    Note:
+                        The returned array is a view of the underlying data, so modifications
+                        to the array will affect the original RaggedRangeImage.
+        
+                    Example:
+                        >>> import numpy as np
+                        >>> array = np.asarray(range_image)
+                        >>> rows = np.split(array, range_image.row_offsets[1:-1])
+        """
+    def __getitem__(self, arg0: tuple) -> float:
+        """
+                    Get pixel value at the specified position.
+        
+                    Args:
+                        row (int): Row index (0 to height-1).
+                        col (int): Column index (0 to row_width(row)-1).
+                    Returns:
+                        float: Pixel value at [row, col].
+        """
+    @typing.overload
+    def __init__(self) -> None:
+        """
+        Default constructor (empty image).
+        """
+    @typing.overload
+    def __init__(self, row_widths: collections.abc.Sequence[typing.SupportsInt], initial_value: typing.SupportsFloat) -> None:
+        """
+        Construct with the width of each row and an initial pixel value.
+        """
+    def __repr__(self) -> str:
+        ...
+    def __setitem__(self, arg0: tuple, arg1: typing.SupportsFloat) -> None:
+        """
+                    Set pixel value at the specified position.
+        
+                    Args:
+                        row (int): Row index (0 to height-1).
+                        col (int): Column index (0 to row_width(row)-1).
+                        value (float): Value to set.
+        """
+    def row(self, row: typing.SupportsInt) -> numpy.typing.NDArray[numpy.float64]:
+        """
+                    Get the pixels of a row as a NumPy array (zero-copy view).
+        
+                    Args:
+                        row (int): Row index (0 to height-1).
+                    Returns:
+                        numpy.ndarray: A 1D array view of the row, of length row_width(row).
+        """
+    def row_width(self, row: typing.SupportsInt) -> int:
+        """
+        Width of a row.
+        """
+    @property
+    def height(self) -> int:
+        """
+        Image height.
+        """
+    @property
+    def row_offsets(self) -> numpy.typing.NDArray[numpy.uint64]:
+        """
+        Offset of each row in the pixel array, followed by the total number of pixels (read-only view).
+        """
+    @property
+    def size(self) -> int:
+        """
+        Total number of pixels.
+        """
 class RangeImage:
     """
     
@@ -531,7 +743,7 @@ def error_message(code: ErrorCode) -> str:
             Returns:
                 str: Error message.
     """
-def estimate_intrinsics(x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat]) -> Intrinsics:
+def estimate_intrinsics(x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat], subsample_size: typing.SupportsInt = 0, scanline_labels: collections.abc.Sequence[typing.SupportsInt] | None = None) -> Intrinsics:
     """
             Estimate sensor intrinsics from point cloud coordinates given as float vectors.
     
@@ -539,10 +751,12 @@ def estimate_intrinsics(x: collections.abc.Sequence[typing.SupportsFloat], y: co
                 x (list of float): X coordinates.
                 y (list of float): Y coordinates.
                 z (list of float): Z coordinates.
+                subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points).
+                scanline_labels (list of int, optional): Per-point scanline labels, such as the ring index provided by the driver. Labelled scanlines are fitted directly, falling back to the full search if they are inconsistent.
             Returns:
                 Intrinsics: Estimated sensor intrinsics.
     """
-def estimate_intrinsics_detailed(x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat]) -> IntrinsicsDetailed:
+def estimate_intrinsics_detailed(x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat], subsample_size: typing.SupportsInt = 0, scanline_labels: collections.abc.Sequence[typing.SupportsInt] | None = None) -> IntrinsicsDetailed:
     """
             Estimate detailed sensor intrinsics (including algorithm execution info) from point cloud coordinates given as float vectors.
     
@@ -550,9 +764,22 @@ def estimate_intrinsics_detailed(x: collections.abc.Sequence[typing.SupportsFloa
                 x (list of float): X coordinates.
                 y (list of float): Y coordinates.
                 z (list of float): Z coordinates.
+                subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points). Point counts always refer to the full point cloud.
+                scanline_labels (list of int, optional): Per-point scanline labels, such as the ring index provided by the driver. Labelled scanlines are fitted directly, falling back to the full search if they are inconsistent.
             Returns:
                 IntrinsicsDetailed: Detailed estimated intrinsics and statistics.
     """
+def estimate_intrinsics_from_records(points: typing.Annotated[numpy.typing.ArrayLike, numpy.float32], subsample_size: typing.SupportsInt = 0) -> Intrinsics:
+    """
+            Estimate sensor intrinsics from interleaved point records, such as XYZI frames, without de-interleaving them.
+    
+            Args:
+                points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                    Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+                subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points).
+            Returns:
+                Intrinsics: Estimated sensor intrinsics.
+    """
 def intrinsics_from_json_file(path: str) -> Intrinsics:
     """
             Load intrinsics from a JSON file.
@@ -592,6 +819,57 @@ def intrinsics_to_json_str(intrinsics: Intrinsics, indent: typing.SupportsInt =
             Returns:
                 str: JSON string.
     """
+def project_records_to_ragged_range_image(intrinsics: Intrinsics, points: typing.Annotated[numpy.typing.ArrayLike, numpy.float32]) -> RaggedRangeImage:
+    """
+            Project interleaved point records, such as XYZI frames, to a ragged range image without de-interleaving them.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+                points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                    Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+            Returns:
+                RaggedRangeImage: Projected ragged range image.
+    """
+def project_records_to_range_image(intrinsics: Intrinsics, points: typing.Annotated[numpy.typing.ArrayLike, numpy.float32]) -> RangeImage:
+    """
+            Project interleaved point records, such as XYZI frames, to a range image without de-interleaving them.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+                points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                    Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+            Returns:
+                RangeImage: Projected range image.
+    """
+def project_to_quantized_range_image(intrinsics: Intrinsics, x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat]) -> QuantizedRangeImage:
+    """
+            Project a point cloud to a quantized range image, whose ranges are fixed-point codes.
+    
+            The code step is the coordinate quantization measured on the points, and every stored range is checked
+            against the projected one.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+                x (list of float): X coordinates.
+                y (list of float): Y coordinates.
+                z (list of float): Z coordinates.
+            Returns:
+                QuantizedRangeImage: Projected quantized range image.
+            Raises:
+                RuntimeError: If a range cannot be stored within the round-trip error bound.
+    """
+def project_to_ragged_range_image(intrinsics: Intrinsics, x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat]) -> RaggedRangeImage:
+    """
+            Project a point cloud to a ragged range image, whose rows are as wide as their scanline resolutions.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+                x (list of float): X coordinates.
+                y (list of float): Y coordinates.
+                z (list of float): Z coordinates.
+            Returns:
+                RaggedRangeImage: Projected ragged range image.
+    """
 def project_to_range_image(intrinsics: Intrinsics, x: collections.abc.Sequence[typing.SupportsFloat], y: collections.abc.Sequence[typing.SupportsFloat], z: collections.abc.Sequence[typing.SupportsFloat]) -> RangeImage:
     """
             Project a point cloud to a range image using given intrinsics.
@@ -604,6 +882,7 @@ def project_to_range_image(intrinsics: Intrinsics, x: collections.abc.Sequence[t
             Returns:
                 RangeImage: Projected range image.
     """
+@typing.overload
 def unproject_to_point_cloud(intrinsics: Intrinsics, ri: RangeImage) -> tuple:
     """
             Unproject a range image to a 3D point cloud using given intrinsics.
@@ -614,11 +893,39 @@ def unproject_to_point_cloud(intrinsics: Intrinsics, ri: RangeImage) -> tuple:
             Returns:
                 tuple: (x, y, z) coordinate lists.
     """
+@typing.overload
+def unproject_to_point_cloud(intrinsics: Intrinsics, ri: RaggedRangeImage) -> tuple:
+    """
+            Unproject a ragged range image to a 3D point cloud using given intrinsics.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics.
+                ri (RaggedRangeImage): Input ragged range image.
+            Returns:
+                tuple: (x, y, z) coordinate lists.
+    """
+@typing.overload
+def unproject_to_point_cloud(intrinsics: Intrinsics, ri: QuantizedRangeImage) -> tuple:
+    """
+            Unproject a quantized range image to a 3D point cloud using given intrinsics.
+    
+            Args:
+                intrinsics (Intrinsics): Sensor intrinsics.
+                ri (QuantizedRangeImage): Input quantized range image.
+            Returns:
+                tuple: (x, y, z) coordinate lists.
+    """
 ALL_ASSIGNED: EndReason  # value = <EndReason.ALL_ASSIGNED: 0>
 EMPTY_POINT_CLOUD: ErrorCode  # value = <ErrorCode.EMPTY_POINT_CLOUD: 2>
+FILE_ERROR: ErrorCode  # value = <ErrorCode.FILE_ERROR: 6>
 INTERNAL_ERROR: ErrorCode  # value = <ErrorCode.INTERNAL_ERROR: 4>
+INVALID_FILE_FORMAT: ErrorCode  # value = <ErrorCode.INVALID_FILE_FORMAT: 7>
+INVALID_LAYOUT: ErrorCode  # value = <ErrorCode.INVALID_LAYOUT: 5>
 MAX_ITERATIONS: EndReason  # value = <EndReason.MAX_ITERATIONS: 1>
 MISMATCHED_SIZES: ErrorCode  # value = <ErrorCode.MISMATCHED_SIZES: 1>
 NONE: ErrorCode  # value = <ErrorCode.NONE: 0>
 NO_MORE_PEAKS: EndReason  # value = <EndReason.NO_MORE_PEAKS: 2>
+QUANTIZATION_ERROR: ErrorCode  # value = <ErrorCode.QUANTIZATION_ERROR: 8>
 RANGES_XY_ZERO: ErrorCode  # value = <ErrorCode.RANGES_XY_ZERO: 3>
+UINT16: QuantizedPixelType  # value = <QuantizedPixelType.UINT16: 0>
+UINT32: QuantizedPixelType  # value = <QuantizedPixelType.UINT32: 1>
@@ -1,6 +1,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
+#include <optional>
 #include <string>
 #include <vector>
 #include <alice_lri/Core.hpp>
@@ -21,6 +22,10 @@ PYBIND11_MODULE(_alice_lri, m) {
         .value("EMPTY_POINT_CLOUD", alice_lri::ErrorCode::EMPTY_POINT_CLOUD, "Point cloud is empty.")
         .value("RANGES_XY_ZERO", alice_lri::ErrorCode::RANGES_XY_ZERO, "At least one point has a range of zero in the XY plane.")
         .value("INTERNAL_ERROR", alice_lri::ErrorCode::INTERNAL_ERROR, "Internal error occurred.")
+        .value("INVALID_LAYOUT", alice_lri::ErrorCode::INVALID_LAYOUT, "Strided point records are misaligned or their coordinates exceed the stride.")
+        .value("FILE_ERROR", alice_lri::ErrorCode::FILE_ERROR, "Point cloud file cannot be opened or mapped.")
+        .value("INVALID_FILE_FORMAT", alice_lri::ErrorCode::INVALID_FILE_FORMAT, "Point cloud file is malformed or its format is not supported.")
+        .value("QUANTIZATION_ERROR", alice_lri::ErrorCode::QUANTIZATION_ERROR, "Ranges cannot be stored as fixed-point codes within the round-trip error bound.")
         .export_values();
 
     // Helper function to unwrap Result<T> and throw exceptions
@@ -31,6 +36,45 @@ PYBIND11_MODULE(_alice_lri, m) {
         return result.value();
     };
 
+    // Views over the converted vectors, so that the library reads them in place instead of copying them again
+    auto make_view = [](
+        const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z
+    ) -> alice_lri::PointCloud::DoubleView {
+        if (x.size() != y.size() || y.size() != z.size()) {
+            throw std::runtime_error(
+                std::string(alice_lri::errorMessage(alice_lri::ErrorCode::MISMATCHED_SIZES).c_str())
+            );
+        }
+        return {x.data(), y.data(), z.data(), x.size()};
+    };
+
+    auto make_options = [](const uint64_t subsample_size, const std::optional<std::vector<int32_t>>& scanline_labels) {
+        alice_lri::EstimationOptions options{.subsampleSize = subsample_size};
+        if (scanline_labels) {
+            options.scanlineLabels = scanline_labels->data();
+            options.scanlineLabelsCount = scanline_labels->size();
+        }
+        return options;
+    };
+
+    // Strided view over the rows of an (N, k) float32 array with k >= 3, so that XYZ(I) frames are read in place
+    auto make_strided_view = [](const py::array_t<float>& points) -> alice_lri::PointCloud::FloatStridedView {
+        if (points.ndim() != 2 || points.shape(1) < 3) {
+            throw std::runtime_error("Expected an array of shape (N, k) with k >= 3, holding x, y and z in its first columns");
+        }
+        if (points.strides(0) <= 0 || points.strides(1) <= 0) {
+            throw std::runtime_error("Expected an array with positive strides");
+        }
+        return {
+            .base = points.data(),
+            .size = static_cast<uint64_t>(points.shape(0)),
+            .stride = static_cast<uint64_t>(points.strides(0)),
+            .xOffset = 0,
+            .yOffset = static_cast<uint64_t>(points.strides(1)),
+            .zOffset = static_cast<uint64_t>(2 * points.strides(1))
+        };
+    };
+
     // Enums
     py::enum_<alice_lri::EndReason>(m, "EndReason", R"doc(
         Reason for ending the iterative vertical fitting process.
@@ -40,6 +84,13 @@ PYBIND11_MODULE(_alice_lri, m) {
         .value("NO_MORE_PEAKS", alice_lri::EndReason::NO_MORE_PEAKS, "No more peaks found in the Hough accumulator.")
         .export_values();
 
+    py::enum_<alice_lri::QuantizedPixelType>(m, "QuantizedPixelType", R"doc(
+        Integer type of the pixels of a QuantizedRangeImage.
+    )doc")
+        .value("UINT16", alice_lri::QuantizedPixelType::UINT16, "16-bit unsigned pixels.")
+        .value("UINT32", alice_lri::QuantizedPixelType::UINT32, "32-bit unsigned pixels.")
+        .export_values();
+
     // Core structs
     py::class_<alice_lri::Scanline>(m, "Scanline", R"doc(
         Represents a single scanline with intrinsic parameters.
@@ -266,14 +317,180 @@ PYBIND11_MODULE(_alice_lri, m) {
                 >>> max_range = np.max(array)
         )doc");
 
-    m.def("estimate_intrinsics", [&unwrap_result](const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z) {
-        // Convert std::vector to AliceArray
-        alice_lri::PointCloud::Double cloud;
-        cloud.x = alice_lri::AliceArray<double>(x.data(), x.size());
-        cloud.y = alice_lri::AliceArray<double>(y.data(), y.size());
-        cloud.z = alice_lri::AliceArray<double>(z.data(), z.size());
-        return unwrap_result(alice_lri::estimateIntrinsics(cloud));
-    }, py::arg("x"), py::arg("y"), py::arg("z"),
+    // RaggedRangeImage class
+    py::class_<alice_lri::RaggedRangeImage>(m, "RaggedRangeImage", R"doc(
+        Range image whose rows are as wide as the horizontal resolution of their scanlines.
+
+        Rows are stored back to back, so the number of pixels is the sum of the row widths instead of the height
+        times the least common multiple of the resolutions.
+
+        Args:
+            row_widths (list of int): Width of each row.
+            initial_value (float): Initial value for all pixels.
+    )doc")
+        .def(py::init<>(), "Default constructor (empty image).")
+        .def(py::init([](const std::vector<uint32_t>& row_widths, const double initial_value) {
+            return alice_lri::RaggedRangeImage(
+                row_widths.data(), static_cast<uint32_t>(row_widths.size()), initial_value
+            );
+        }), py::arg("row_widths"), py::arg("initial_value"), "Construct with the width of each row and an initial pixel value.")
+        .def_property_readonly("height", &alice_lri::RaggedRangeImage::height, "Image height.")
+        .def_property_readonly("size", &alice_lri::RaggedRangeImage::size, "Total number of pixels.")
+        .def_property_readonly("row_offsets", [](py::object self) {
+            auto& ri = self.cast<const alice_lri::RaggedRangeImage&>();
+            py::array_t<uint64_t> offsets({ri.height() + 1}, {sizeof(uint64_t)}, ri.rowOffsets(), self);
+            // The offsets describe the layout of the image, so they must not be written through the view
+            py::detail::array_proxy(offsets.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+            return offsets;
+        }, "Offset of each row in the pixel array, followed by the total number of pixels (read-only view).")
+        .def("row_width", [](const alice_lri::RaggedRangeImage &ri, const uint32_t row) {
+            if (row >= ri.height())
+                throw py::index_error("Index out of bounds");
+            return ri.rowWidth(row);
+        }, py::arg("row"), "Width of a row.")
+        .def("row", [](py::object self, const uint32_t row) {
+            auto& ri = self.cast<alice_lri::RaggedRangeImage&>();
+            if (row >= ri.height())
+                throw py::index_error("Index out of bounds");
+            return py::array_t<double>({ri.rowWidth(row)}, {sizeof(double)}, ri.data() + ri.rowOffset(row), self);
+        }, py::arg("row"), R"doc(
+            Get the pixels of a row as a NumPy array (zero-copy view).
+
+            Args:
+                row (int): Row index (0 to height-1).
+            Returns:
+                numpy.ndarray: A 1D array view of the row, of length row_width(row).
+        )doc")
+        .def("__repr__", [](const alice_lri::RaggedRangeImage& self) {
+            std::ostringstream oss;
+            oss << "RaggedRangeImage(height=" << self.height() << ", size=" << self.size() << ")";
+            return oss.str();
+        })
+        .def("__getitem__", [](const alice_lri::RaggedRangeImage &ri, py::tuple idx) -> double {
+            if (idx.size() != 2)
+                throw py::index_error("Need 2 indices");
+            size_t row = idx[0].cast<size_t>();
+            size_t col = idx[1].cast<size_t>();
+            if (row >= ri.height() || col >= ri.rowWidth(row))
+                throw py::index_error("Index out of bounds");
+            return ri(row, col);
+        }, py::is_operator(), R"doc(
+            Get pixel value at the specified position.
+
+            Args:
+                row (int): Row index (0 to height-1).
+                col (int): Column index (0 to row_width(row)-1).
+            Returns:
+                float: Pixel value at [row, col].
+        )doc")
+        .def("__setitem__", [](alice_lri::RaggedRangeImage &ri, py::tuple idx, double value) {
+            if (idx.size() != 2)
+                throw py::index_error("Need 2 indices");
+            size_t row = idx[0].cast<size_t>();
+            size_t col = idx[1].cast<size_t>();
+            if (row >= ri.height() || col >= ri.rowWidth(row))
+                throw py::index_error("Index out of bounds");
+            ri(row, col) = value;
+        }, py::is_operator(), R"doc(
+            Set pixel value at the specified position.
+
+            Args:
+                row (int): Row index (0 to height-1).
+                col (int): Column index (0 to row_width(row)-1).
+                value (float): Value to set.
+        )doc")
+        .def("__array__", [](py::object self, py::kwargs kwargs) {
+            auto& ri = self.cast<const alice_lri::RaggedRangeImage&>();
+            return py::array_t<double>(
+                {ri.size()},          // shape
+                {sizeof(double)},     // strides
+                ri.data(),            // pointer to data
+                self                  // keep alive
+            );
+        }, R"doc(
+            Convert RaggedRangeImage to a flat NumPy array with all rows back to back (zero-copy view).
+
+            Returns:
+                numpy.ndarray: A 1D array view of the pixel data. Row r is array[row_offsets[r]:row_offsets[r + 1]].
+
+            Note:
+                The returned array is a view of the underlying data, so modifications
+                to the array will affect the original RaggedRangeImage.
+
+            Example:
+                >>> import numpy as np
+                >>> array = np.asarray(range_image)
+                >>> rows = np.split(array, range_image.row_offsets[1:-1])
+        )doc");
+
+    // QuantizedRangeImage class
+    py::class_<alice_lri::QuantizedRangeImage>(m, "QuantizedRangeImage", R"doc(
+        Range image with fixed-point pixels, laid out like RangeImage.
+
+        A pixel stores an integer code, with zero for empty pixels. Its range is offset + code * scale, within
+        max_range_error of the projected range. The pixels are 16-bit when the codes fit, and 32-bit otherwise.
+    )doc")
+        .def(py::init<>(), "Default constructor (empty image).")
+        .def_property_readonly("width", &alice_lri::QuantizedRangeImage::width, "Image width.")
+        .def_property_readonly("height", &alice_lri::QuantizedRangeImage::height, "Image height.")
+        .def_property_readonly("pixel_type", &alice_lri::QuantizedRangeImage::pixelType, "Pixel type.")
+        .def_property_readonly("scale", &alice_lri::QuantizedRangeImage::scale, "Range step of one code.")
+        .def_property_readonly("offset", &alice_lri::QuantizedRangeImage::offset, "Range of code zero.")
+        .def_property_readonly("max_range_error", &alice_lri::QuantizedRangeImage::maxRangeError, "Largest difference between a stored range and the projected one.")
+        .def("to_range_image", &alice_lri::QuantizedRangeImage::toRangeImage, "Restore the ranges into a RangeImage, with zero for empty pixels.")
+        .def("__repr__", [](const alice_lri::QuantizedRangeImage& self) {
+            std::ostringstream oss;
+            oss << "QuantizedRangeImage(width=" << self.width() << ", height=" << self.height()
+                << ", scale=" << self.scale() << ", offset=" << self.offset() << ")";
+            return oss.str();
+        })
+        .def("__getitem__", [](const alice_lri::QuantizedRangeImage &ri, py::tuple idx) -> double {
+            if (idx.size() != 2)
+                throw py::index_error("Need 2 indices");
+            size_t row = idx[0].cast<size_t>();
+            size_t col = idx[1].cast<size_t>();
+            if (row >= ri.height() || col >= ri.width())
+                throw py::index_error("Index out of bounds");
+            return ri.range(row, col);
+        }, py::is_operator(), R"doc(
+            Get the range stored at the specified position.
+
+            Args:
+                row (int): Row index (0 to height-1).
+                col (int): Column index (0 to width-1).
+            Returns:
+                float: Range at [row, col], zero if empty.
+        )doc")
+        .def("__array__", [](py::object self, py::kwargs kwargs) -> py::array {
+            auto& ri = self.cast<const alice_lri::QuantizedRangeImage&>();
+            if (ri.pixelType() == alice_lri::QuantizedPixelType::UINT16) {
+                return py::array_t<uint16_t>(
+                    {ri.height(), ri.width()}, {sizeof(uint16_t) * ri.width(), sizeof(uint16_t)}, ri.data16(), self
+                );
+            }
+            return py::array_t<uint32_t>(
+                {ri.height(), ri.width()}, {sizeof(uint32_t) * ri.width(), sizeof(uint32_t)}, ri.data32(), self
+            );
+        }, R"doc(
+            Convert the pixel codes to a NumPy array (zero-copy view).
+
+            Returns:
+                numpy.ndarray: A 2D uint16 or uint32 array view of the codes, with zero for empty pixels.
+
+            Example:
+                >>> import numpy as np
+                >>> codes = np.asarray(range_image)
+                >>> ranges = np.where(codes > 0, range_image.offset + codes * range_image.scale, 0)
+        )doc");
+
+    m.def("estimate_intrinsics", [&unwrap_result, &make_view, &make_options](
+        const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z,
+        const uint64_t subsample_size, const std::optional<std::vector<int32_t>>& scanline_labels
+    ) {
+        const auto cloud = make_view(x, y, z);
+        const auto options = make_options(subsample_size, scanline_labels);
+        return unwrap_result(alice_lri::estimateIntrinsics(cloud, options));
+    }, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("subsample_size") = 0, py::arg("scanline_labels") = py::none(),
        R"doc(
         Estimate sensor intrinsics from point cloud coordinates given as float vectors.
 
@@ -281,37 +498,38 @@ PYBIND11_MODULE(_alice_lri, m) {
             x (list of float): X coordinates.
             y (list of float): Y coordinates.
             z (list of float): Z coordinates.
+            subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points).
+            scanline_labels (list of int, optional): Per-point scanline labels, such as the ring index provided by the driver. Labelled scanlines are fitted directly, falling back to the full search if they are inconsistent.
         Returns:
             Intrinsics: Estimated sensor intrinsics.
     )doc");
 
-    m.def("estimate_intrinsics_detailed", [&unwrap_result](const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z) {
-        // Convert std::vector to AliceArray
-        alice_lri::PointCloud::Double cloud;
-        cloud.x = alice_lri::AliceArray<double>(x.data(), x.size());
-        cloud.y = alice_lri::AliceArray<double>(y.data(), y.size());
-        cloud.z = alice_lri::AliceArray<double>(z.data(), z.size());
-        return unwrap_result(alice_lri::estimateIntrinsicsDetailed(cloud));
-    }, py::arg("x"), py::arg("y"), py::arg("z"), R"doc(
+    m.def("estimate_intrinsics_detailed", [&unwrap_result, &make_view, &make_options](
+        const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z,
+        const uint64_t subsample_size, const std::optional<std::vector<int32_t>>& scanline_labels
+    ) {
+        const auto cloud = make_view(x, y, z);
+        const auto options = make_options(subsample_size, scanline_labels);
+        return unwrap_result(alice_lri::estimateIntrinsicsDetailed(cloud, options));
+    }, py::arg("x"), py::arg("y"), py::arg("z"), py::arg("subsample_size") = 0, py::arg("scanline_labels") = py::none(),
+       R"doc(
         Estimate detailed sensor intrinsics (including algorithm execution info) from point cloud coordinates given as float vectors.
 
         Args:
             x (list of float): X coordinates.
             y (list of float): Y coordinates.
             z (list of float): Z coordinates.
+            subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points). Point counts always refer to the full point cloud.
+            scanline_labels (list of int, optional): Per-point scanline labels, such as the ring index provided by the driver. Labelled scanlines are fitted directly, falling back to the full search if they are inconsistent.
         Returns:
             IntrinsicsDetailed: Detailed estimated intrinsics and statistics.
     )doc");
 
-    m.def("project_to_range_image", [&unwrap_result](
+    m.def("project_to_range_image", [&unwrap_result, &make_view](
         const alice_lri::Intrinsics& intrinsics, const std::vector<double>& x, const std::vector<double>& y,
         const std::vector<double>& z
     ) {
-        // Convert std::vector to AliceArray
-        alice_lri::PointCloud::Double cloud;
-        cloud.x = alice_lri::AliceArray<double>(x.data(), x.size());
-        cloud.y = alice_lri::AliceArray<double>(y.data(), y.size());
-        cloud.z = alice_lri::AliceArray<double>(z.data(), z.size());
+        const auto cloud = make_view(x, y, z);
         return unwrap_result(alice_lri::projectToRangeImage(intrinsics, cloud));
     }, py::arg("intrinsics"), py::arg("x"), py::arg("y"), py::arg("z"), R"doc(
         Project a point cloud to a range image using given intrinsics.
@@ -325,6 +543,100 @@ PYBIND11_MODULE(_alice_lri, m) {
             RangeImage: Projected range image.
     )doc");
 
+    m.def("project_to_ragged_range_image", [&unwrap_result, &make_view](
+        const alice_lri::Intrinsics& intrinsics, const std::vector<double>& x, const std::vector<double>& y,
+        const std::vector<double>& z
+    ) {
+        const auto cloud = make_view(x, y, z);
+        return unwrap_result(alice_lri::projectToRaggedRangeImage(intrinsics, cloud));
+    }, py::arg("intrinsics"), py::arg("x"), py::arg("y"), py::arg("z"), R"doc(
+        Project a point cloud to a ragged range image, whose rows are as wide as their scanline resolutions.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+            x (list of float): X coordinates.
+            y (list of float): Y coordinates.
+            z (list of float): Z coordinates.
+        Returns:
+            RaggedRangeImage: Projected ragged range image.
+    )doc");
+
+    m.def("project_to_quantized_range_image", [&unwrap_result, &make_view](
+        const alice_lri::Intrinsics& intrinsics, const std::vector<double>& x, const std::vector<double>& y,
+        const std::vector<double>& z
+    ) {
+        // The prepared cloud measures the coordinate quantization. It is move-only, so it is not unwrapped by copy
+        const auto cloud = alice_lri::prepareCloud(make_view(x, y, z));
+        if (!cloud.ok()) {
+            throw std::runtime_error(std::string(cloud.status().message.c_str()));
+        }
+        return unwrap_result(alice_lri::projectToQuantizedRangeImage(intrinsics, *cloud));
+    }, py::arg("intrinsics"), py::arg("x"), py::arg("y"), py::arg("z"), R"doc(
+        Project a point cloud to a quantized range image, whose ranges are fixed-point codes.
+
+        The code step is the coordinate quantization measured on the points, and every stored range is checked
+        against the projected one.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+            x (list of float): X coordinates.
+            y (list of float): Y coordinates.
+            z (list of float): Z coordinates.
+        Returns:
+            QuantizedRangeImage: Projected quantized range image.
+        Raises:
+            RuntimeError: If a range cannot be stored within the round-trip error bound.
+    )doc");
+
+    m.def("estimate_intrinsics_from_records", [&unwrap_result, &make_strided_view](
+        const py::array_t<float>& points, const uint64_t subsample_size
+    ) {
+        const auto cloud = make_strided_view(points);
+        const alice_lri::EstimationOptions options{.subsampleSize = subsample_size};
+        return unwrap_result(alice_lri::estimateIntrinsics(cloud, options));
+    }, py::arg("points"), py::arg("subsample_size") = 0, R"doc(
+        Estimate sensor intrinsics from interleaved point records, such as XYZI frames, without de-interleaving them.
+
+        Args:
+            points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+            subsample_size (int, optional): Number of points of the stratified subsample used for estimation (0 uses all points).
+        Returns:
+            Intrinsics: Estimated sensor intrinsics.
+    )doc");
+
+    m.def("project_records_to_range_image", [&unwrap_result, &make_strided_view](
+        const alice_lri::Intrinsics& intrinsics, const py::array_t<float>& points
+    ) {
+        const auto cloud = make_strided_view(points);
+        return unwrap_result(alice_lri::projectToRangeImage(intrinsics, cloud));
+    }, py::arg("intrinsics"), py::arg("points"), R"doc(
+        Project interleaved point records, such as XYZI frames, to a range image without de-interleaving them.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+            points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+        Returns:
+            RangeImage: Projected range image.
+    )doc");
+
+    m.def("project_records_to_ragged_range_image", [&unwrap_result, &make_strided_view](
+        const alice_lri::Intrinsics& intrinsics, const py::array_t<float>& points
+    ) {
+        const auto cloud = make_strided_view(points);
+        return unwrap_result(alice_lri::projectToRaggedRangeImage(intrinsics, cloud));
+    }, py::arg("intrinsics"), py::arg("points"), R"doc(
+        Project interleaved point records, such as XYZI frames, to a ragged range image without de-interleaving them.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics (see estimate_intrinsics).
+            points (numpy.ndarray): Array of shape (N, k) with k >= 3, whose first three columns are x, y and z.
+                Extra columns such as intensity are ignored. Non-float32 arrays are converted first.
+        Returns:
+            RaggedRangeImage: Projected ragged range image.
+    )doc");
+
     m.def("unproject_to_point_cloud", [](const alice_lri::Intrinsics& intrinsics, const alice_lri::RangeImage& ri) {
         auto cloud = alice_lri::unProjectToPointCloud(intrinsics, ri);
         // Convert AliceArray to std::vector for Python convenience
@@ -342,6 +654,38 @@ PYBIND11_MODULE(_alice_lri, m) {
             tuple: (x, y, z) coordinate lists.
     )doc");
 
+    m.def("unproject_to_point_cloud", [](const alice_lri::Intrinsics& intrinsics, const alice_lri::RaggedRangeImage& ri) {
+        auto cloud = alice_lri::unProjectToPointCloud(intrinsics, ri);
+        std::vector<double> x_vec(cloud.x.begin(), cloud.x.end());
+        std::vector<double> y_vec(cloud.y.begin(), cloud.y.end());
+        std::vector<double> z_vec(cloud.z.begin(), cloud.z.end());
+        return py::make_tuple(x_vec, y_vec, z_vec);
+    }, py::arg("intrinsics"), py::arg("ri"), R"doc(
+        Unproject a ragged range image to a 3D point cloud using given intrinsics.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics.
+            ri (RaggedRangeImage): Input ragged range image.
+        Returns:
+            tuple: (x, y, z) coordinate lists.
+    )doc");
+
+    m.def("unproject_to_point_cloud", [](const alice_lri::Intrinsics& intrinsics, const alice_lri::QuantizedRangeImage& ri) {
+        auto cloud = alice_lri::unProjectToPointCloud(intrinsics, ri);
+        std::vector<double> x_vec(cloud.x.begin(), cloud.x.end());
+        std::vector<double> y_vec(cloud.y.begin(), cloud.y.end());
+        std::vector<double> z_vec(cloud.z.begin(), cloud.z.end());
+        return py::make_tuple(x_vec, y_vec, z_vec);
+    }, py::arg("intrinsics"), py::arg("ri"), R"doc(
+        Unproject a quantized range image to a 3D point cloud using given intrinsics.
+
+        Args:
+            intrinsics (Intrinsics): Sensor intrinsics.
+            ri (QuantizedRangeImage): Input quantized range image.
+        Returns:
+            tuple: (x, y, z) coordinate lists.
+    )doc");
+
     // JSON functions
     m.def("intrinsics_to_json_str", [](const alice_lri::Intrinsics& intrinsics, int32_t indent = -1) {
         auto result = alice_lri::intrinsicsToJsonStr(intrinsics, indent);
@@ -1,16 +1,31 @@
 #include <gtest/gtest.h>
 #include "alice_lri/Core.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
 #include <vector>
 
 class ALICELRIAPITest : public ::testing::Test {
 protected:
     void SetUp() override {
-        // Initialize test data
+        // Two scanlines with every intrinsic set, and a ring of points alternating between them
+        ringIntrinsics.scanlines[0] = {0.1, -0.1, 0.05, 0.01, 360};
+        ringIntrinsics.scanlines[1] = {0.1, 0.1, 0.05, 0.01, 360};
+
+        for (int i = 0; i < 100; ++i) {
+            const double theta = i * 0.0628;
+            ring.x.emplace_back(10 * std::cos(theta));
+            ring.y.emplace_back(10 * std::sin(theta));
+            ring.z.emplace_back(i % 2 == 0 ? -1.0 : 1.0);
+        }
     }
 
     void TearDown() override {
         // Clean up any test state
     }
+
+    alice_lri::Intrinsics ringIntrinsics{2};
+    alice_lri::PointCloud::Double ring;
 };
 
 TEST_F(ALICELRIAPITest, ExecuteWithEmptyData) {
@@ -19,4 +34,328 @@ TEST_F(ALICELRIAPITest, ExecuteWithEmptyData) {
 
     assert(!result.ok());
     assert(result.status().code == alice_lri::ErrorCode::EMPTY_POINT_CLOUD);
-} 
\ No newline at end of file
+} 
+
+TEST_F(ALICELRIAPITest, ViewValidatesLikeOwningCloud) {
+    const std::vector<float> x = {1, 0, 2}, y = {0, 0, 1}, z = {0, 1, 0};
+    const alice_lri::PointCloud::FloatView view{x.data(), y.data(), z.data(), x.size()};
+
+    const auto result = alice_lri::estimateIntrinsics(view);
+    EXPECT_FALSE(result.ok());
+    EXPECT_EQ(result.status().code, alice_lri::ErrorCode::RANGES_XY_ZERO);
+
+    const auto emptyResult = alice_lri::estimateIntrinsics(alice_lri::PointCloud::FloatView{});
+    EXPECT_EQ(emptyResult.status().code, alice_lri::ErrorCode::EMPTY_POINT_CLOUD);
+}
+
+TEST_F(ALICELRIAPITest, ViewProjectsLikeOwningCloud) {
+    const alice_lri::PointCloud::DoubleView view{ring.x.data(), ring.y.data(), ring.z.data(), ring.x.size()};
+
+    const auto owning = alice_lri::projectToRangeImage(ringIntrinsics, ring);
+    const auto viewed = alice_lri::projectToRangeImage(ringIntrinsics, view);
+    ASSERT_TRUE(owning.ok());
+    ASSERT_TRUE(viewed.ok());
+    ASSERT_EQ(owning->size(), viewed->size());
+    for (uint64_t i = 0; i < owning->size(); ++i) {
+        EXPECT_EQ(owning->data()[i], viewed->data()[i]);
+    }
+}
+
+TEST_F(ALICELRIAPITest, StridedViewProjectsLikeSeparateBuffers) {
+    // XYZI records, as in KITTI frames
+    std::vector<float> records, x, y, z;
+    for (uint64_t i = 0; i < ring.x.size(); ++i) {
+        x.emplace_back(static_cast<float>(ring.x[i]));
+        y.emplace_back(static_cast<float>(ring.y[i]));
+        z.emplace_back(static_cast<float>(ring.z[i]));
+        records.insert(records.end(), {x.back(), y.back(), z.back(), 0.5f});
+    }
+    const alice_lri::PointCloud::FloatView view{x.data(), y.data(), z.data(), x.size()};
+    const alice_lri::PointCloud::FloatStridedView strided{.base = records.data(), .size = x.size()};
+
+    const auto separate = alice_lri::projectToRangeImage(ringIntrinsics, view);
+    const auto interleaved = alice_lri::projectToRangeImage(ringIntrinsics, strided);
+    ASSERT_TRUE(separate.ok());
+    ASSERT_TRUE(interleaved.ok());
+    ASSERT_EQ(separate->size(), interleaved->size());
+    for (uint64_t i = 0; i < separate->size(); ++i) {
+        EXPECT_EQ(separate->data()[i], interleaved->data()[i]);
+    }
+
+    const alice_lri::PointCloud::FloatStridedView misaligned{.base = records.data(), .size = x.size(), .stride = 15};
+    EXPECT_EQ(alice_lri::estimateIntrinsics(misaligned).status().code, alice_lri::ErrorCode::INVALID_LAYOUT);
+
+    // Aligned fields that start at or past the end of a record would read beyond the last one
+    const alice_lri::PointCloud::FloatStridedView outside{.base = records.data(), .size = x.size(), .stride = 16,
+                                                          .xOffset = 16};
+    EXPECT_EQ(alice_lri::estimateIntrinsics(outside).status().code, alice_lri::ErrorCode::INVALID_LAYOUT);
+    EXPECT_EQ(alice_lri::projectToRangeImage(ringIntrinsics, outside).status().code,
+              alice_lri::ErrorCode::INVALID_LAYOUT);
+    const alice_lri::PointCloud::FloatStridedView lastField{.base = records.data(), .size = x.size(), .stride = 16,
+                                                            .zOffset = 12};
+    EXPECT_TRUE(alice_lri::projectToRangeImage(ringIntrinsics, lastField).ok());
+}
+
+TEST_F(ALICELRIAPITest, PreparedCloudProjectsLikeDoubleCloud) {
+    auto prepared = alice_lri::prepareCloud(ring);
+    ASSERT_TRUE(prepared.ok());
+    EXPECT_EQ(prepared->size(), ring.x.size());
+
+    const auto direct = alice_lri::projectToRangeImage(ringIntrinsics, ring);
+    const auto reused = alice_lri::projectToRangeImage(ringIntrinsics, *prepared);
+    ASSERT_TRUE(direct.ok());
+    ASSERT_TRUE(reused.ok());
+    ASSERT_EQ(direct->size(), reused->size());
+    for (uint64_t i = 0; i < direct->size(); ++i) {
+        EXPECT_EQ(direct->data()[i], reused->data()[i]);
+    }
+
+    // Estimation only reads the prepared fields, so a later projection still gives the same image
+    alice_lri::estimateIntrinsics(*prepared);
+    const auto afterEstimation = alice_lri::projectToRangeImage(ringIntrinsics, *prepared);
+    ASSERT_TRUE(afterEstimation.ok());
+    for (uint64_t i = 0; i < direct->size(); ++i) {
+        EXPECT_EQ(direct->data()[i], afterEstimation->data()[i]);
+    }
+
+    const alice_lri::PreparedCloud moved = std::move(*prepared);
+    EXPECT_EQ(alice_lri::projectToRangeImage(ringIntrinsics, *prepared).status().code,
+              alice_lri::ErrorCode::EMPTY_POINT_CLOUD);
+    EXPECT_EQ(moved.size(), ring.x.size());
+}
+
+TEST_F(ALICELRIAPITest, ScanlineLabelsEstimateVerticalIntrinsics) {
+    const std::vector<double> angles = {-0.2, -0.1, 0.0, 0.1};
+    constexpr int pointsPerScanline = 1000;
+
+    alice_lri::PointCloud::Double cloud;
+    std::vector<int32_t> labels;
+    for (size_t scanline = 0; scanline < angles.size(); ++scanline) {
+        for (int i = 0; i < pointsPerScanline; ++i) {
+            const double theta = -std::numbers::pi + 2 * std::numbers::pi * i / pointsPerScanline;
+            const double range = 10 + (i % 7);
+            cloud.x.emplace_back(range * std::cos(angles[scanline]) * std::cos(theta));
+            cloud.y.emplace_back(range * std::cos(angles[scanline]) * std::sin(theta));
+            cloud.z.emplace_back(range * std::sin(angles[scanline]));
+            labels.emplace_back(static_cast<int32_t>(scanline));
+        }
+    }
+
+    alice_lri::EstimationOptions options;
+    options.scanlineLabels = labels.data();
+    options.scanlineLabelsCount = labels.size();
+
+    const auto result = alice_lri::estimateIntrinsicsDetailed(cloud, options);
+    ASSERT_TRUE(result.ok());
+    EXPECT_EQ(result->verticalIterations, 0);
+    ASSERT_EQ(result->scanlines.size(), angles.size());
+    for (size_t scanline = 0; scanline < angles.size(); ++scanline) {
+        EXPECT_NEAR(result->scanlines[scanline].verticalAngle.value, angles[scanline], 1e-6);
+        EXPECT_EQ(result->scanlines[scanline].pointsCount, pointsPerScanline);
+    }
+
+    // Driver IDs need not be contiguous nor smaller than the number of points
+    std::vector<int32_t> sparseLabels(labels.size());
+    std::ranges::transform(labels, sparseLabels.begin(), [](const int32_t label) { return 100000 - 1000 * label; });
+    options.scanlineLabels = sparseLabels.data();
+    const auto sparse = alice_lri::estimateIntrinsicsDetailed(cloud, options);
+    ASSERT_TRUE(sparse.ok());
+    EXPECT_EQ(sparse->verticalIterations, 0);
+    ASSERT_EQ(sparse->scanlines.size(), angles.size());
+    for (size_t scanline = 0; scanline < angles.size(); ++scanline) {
+        EXPECT_NEAR(sparse->scanlines[scanline].verticalAngle.value, angles[scanline], 1e-6);
+    }
+
+    // Labels that merge two scanlines cannot be fitted as one, so the full search takes over
+    options.scanlineLabels = labels.data();
+    std::ranges::replace(labels, 1, 0);
+    const auto fallback = alice_lri::estimateIntrinsicsDetailed(cloud, options);
+    ASSERT_TRUE(fallback.ok());
+    EXPECT_GT(fallback->verticalIterations, 0);
+    EXPECT_EQ(fallback->scanlines.size(), angles.size());
+
+    options.scanlineLabelsCount = labels.size() - 1;
+    EXPECT_EQ(alice_lri::estimateIntrinsics(cloud, options).status().code, alice_lri::ErrorCode::MISMATCHED_SIZES);
+}
+
+TEST_F(ALICELRIAPITest, UnprojectionRoundTripsLikeLibm) {
+    alice_lri::RangeImage image(360, 2, 0);
+    for (uint32_t row = 0; row < image.height(); ++row) {
+        for (uint32_t col = row; col < image.width(); col += 3) {
+            image(row, col) = 2 + 0.37 * col + row;
+        }
+    }
+
+    // Reference unprojection written with libm, as the points must not carry the error of any fast kernel
+    alice_lri::PointCloud::Double expected;
+    for (uint32_t row = 0; row < image.height(); ++row) {
+        const auto &scanline = ringIntrinsics.scanlines[image.height() - row - 1];
+        for (uint32_t col = 0; col < image.width(); ++col) {
+            const double range = image(row, col);
+            if (range <= 0) {
+                continue;
+            }
+
+            const double phi = scanline.verticalAngle + scanline.verticalOffset / range;
+            const double rangeXy = range * std::cos(phi);
+            double theta = col * 2 * std::numbers::pi / image.width() - std::numbers::pi;
+            theta += scanline.horizontalOffset / rangeXy + scanline.azimuthalOffset;
+            theta -= 2 * std::numbers::pi * std::floor(theta / (2 * std::numbers::pi));
+            expected.x.emplace_back(rangeXy * std::cos(theta));
+            expected.y.emplace_back(rangeXy * std::sin(theta));
+            expected.z.emplace_back(range * std::sin(phi));
+        }
+    }
+
+    const auto points = alice_lri::unProjectToPointCloud(ringIntrinsics, image);
+    ASSERT_EQ(points.x.size(), expected.x.size());
+    for (uint64_t i = 0; i < points.x.size(); ++i) {
+        EXPECT_EQ(points.x[i], expected.x[i]);
+        EXPECT_EQ(points.y[i], expected.y[i]);
+        EXPECT_EQ(points.z[i], expected.z[i]);
+    }
+
+    const auto reprojected = alice_lri::projectToRangeImage(ringIntrinsics, points);
+    ASSERT_TRUE(reprojected.ok());
+    ASSERT_EQ(reprojected->size(), image.size());
+    for (uint64_t i = 0; i < image.size(); ++i) {
+        EXPECT_NEAR(reprojected->data()[i], image.data()[i], 1e-9);
+    }
+}
+
+TEST_F(ALICELRIAPITest, CollidingPointsKeepTheLastInInputOrder) {
+    alice_lri::Intrinsics intrinsics(1);
+    intrinsics.scanlines[0] = {0, 0, 0, 0, 360};
+
+    // Enough points to span several projection blocks, with the same direction repeated at growing ranges
+    alice_lri::PointCloud::Double cloud;
+    for (int i = 0; i < 10000; ++i) {
+        const double range = 1 + i;
+        cloud.x.emplace_back(range);
+        cloud.y.emplace_back(0);
+        cloud.z.emplace_back(0);
+    }
+
+    const auto image = alice_lri::projectToRangeImage(intrinsics, cloud);
+    ASSERT_TRUE(image.ok());
+    EXPECT_EQ((*image)(0, 180), 10000);
+}
+
+TEST_F(ALICELRIAPITest, RaggedRangeImageKeepsScanlineResolutions) {
+    alice_lri::Intrinsics intrinsics(2);
+    intrinsics.scanlines[0] = {0, -0.1, 0, 0, 360};
+    intrinsics.scanlines[1] = {0, 0.1, 0, 0, 250};
+
+    // One point at the centre of every pixel of each scanline
+    alice_lri::PointCloud::Double cloud;
+    for (const auto &scanline: intrinsics.scanlines) {
+        for (int32_t col = 0; col < scanline.resolution; ++col) {
+            const double theta = col * 2 * std::numbers::pi / scanline.resolution - std::numbers::pi;
+            cloud.x.emplace_back(10 * std::cos(scanline.verticalAngle) * std::cos(theta));
+            cloud.y.emplace_back(10 * std::cos(scanline.verticalAngle) * std::sin(theta));
+            cloud.z.emplace_back(10 * std::sin(scanline.verticalAngle));
+        }
+    }
+
+    const auto image = alice_lri::projectToRaggedRangeImage(intrinsics, cloud);
+    ASSERT_TRUE(image.ok());
+    ASSERT_EQ(image->height(), 2);
+    EXPECT_EQ(image->rowWidth(0), 250);
+    EXPECT_EQ(image->rowWidth(1), 360);
+    EXPECT_EQ(image->rowOffset(1), 250);
+    EXPECT_EQ(image->size(), 610);
+    const auto filled = std::count_if(image->data(), image->data() + image->size(), [](const double range) {
+        return range > 0;
+    });
+    EXPECT_EQ(filled, 610);
+
+    const auto points = alice_lri::unProjectToPointCloud(intrinsics, *image);
+    ASSERT_EQ(points.x.size(), cloud.x.size());
+    for (uint64_t i = 0; i < points.x.size(); ++i) {
+        // Rows are unprojected from the top, which is the last scanline
+        const uint64_t expected = i < 250 ? 360 + i : i - 250;
+        EXPECT_NEAR(points.x[i], cloud.x[expected], 1e-9);
+        EXPECT_NEAR(points.y[i], cloud.y[expected], 1e-9);
+        EXPECT_NEAR(points.z[i], cloud.z[expected], 1e-9);
+    }
+}
+
+TEST_F(ALICELRIAPITest, QuantizedRangeImageRoundTripsRanges) {
+    // Coordinates rounded to millimetres, as reported by many sensors
+    const auto makeCloud = [](const double maxRange) {
+        alice_lri::PointCloud::Double cloud;
+        for (int i = 0; i < 200; ++i) {
+            const double theta = i * 0.0314;
+            const double range = 2 + (maxRange - 2) * i / 199;
+            cloud.x.emplace_back(std::round(range * std::cos(theta) * 1000) / 1000);
+            cloud.y.emplace_back(std::round(range * std::sin(theta) * 1000) / 1000);
+            // Heights one millimetre apart, so that the measured coordinate step is the millimetre
+            cloud.z.emplace_back(((i % 2 == 0 ? -200 : 200) + i / 2 % 4) / 1000.0);
+        }
+        return cloud;
+    };
+
+    for (const auto &[maxRange, pixelType]: std::vector<std::pair<double, alice_lri::QuantizedPixelType>>{
+             {40, alice_lri::QuantizedPixelType::UINT16}, {120, alice_lri::QuantizedPixelType::UINT32}}) {
+        const auto cloud = makeCloud(maxRange);
+        const auto image = alice_lri::projectToRangeImage(ringIntrinsics, cloud);
+        const auto quantized = alice_lri::projectToQuantizedRangeImage(ringIntrinsics, cloud);
+        ASSERT_TRUE(image.ok());
+        ASSERT_TRUE(quantized.ok());
+
+        EXPECT_EQ(quantized->pixelType(), pixelType);
+        EXPECT_LE(quantized->maxRangeError(), 1e-3);
+        ASSERT_EQ(quantized->width(), image->width());
+        ASSERT_EQ(quantized->height(), image->height());
+
+        for (uint32_t row = 0; row < image->height(); ++row) {
+            for (uint32_t col = 0; col < image->width(); ++col) {
+                const double range = (*image)(row, col);
+                EXPECT_EQ(quantized->code(row, col) == 0, range == 0);
+                EXPECT_LE(std::abs(quantized->range(row, col) - range), quantized->maxRangeError() * (1 + 1e-6));
+            }
+        }
+
+        EXPECT_EQ(alice_lri::unProjectToPointCloud(ringIntrinsics, *quantized).x.size(), cloud.x.size());
+    }
+
+    // Codes of a millimetre step cannot span thousands of kilometres, even with 32 bits
+    const auto far = alice_lri::projectToQuantizedRangeImage(ringIntrinsics, makeCloud(1e7));
+    EXPECT_EQ(far.status().code, alice_lri::ErrorCode::QUANTIZATION_ERROR);
+}
+
+TEST_F(ALICELRIAPITest, FloatQuantizedRangeImageFollowsFloatProjection) {
+    alice_lri::Intrinsics intrinsics(1);
+    intrinsics.scanlines[0] = {0, 0, 0, 0, 360};
+
+    // Azimuths just past each column boundary, so that rounding them to floats moves some points to the previous
+    // column. Heights one millimetre apart set the measured coordinate step
+    alice_lri::PointCloud::Float cloud;
+    alice_lri::PointCloud::Double widened;
+    for (int i = 0; i < 360; ++i) {
+        const double theta = -std::numbers::pi + (i + 0.5) * 2 * std::numbers::pi / 360 + 1e-9;
+        cloud.x.emplace_back(static_cast<float>(10 * std::cos(theta)));
+        cloud.y.emplace_back(static_cast<float>(10 * std::sin(theta)));
+        cloud.z.emplace_back(static_cast<float>(i % 2) / 1000);
+        widened.x.emplace_back(cloud.x[i]);
+        widened.y.emplace_back(cloud.y[i]);
+        widened.z.emplace_back(cloud.z[i]);
+    }
+
+    const auto image = alice_lri::projectToRangeImage(intrinsics, cloud);
+    const auto doubleImage = alice_lri::projectToRangeImage(intrinsics, widened);
+    const auto quantized = alice_lri::projectToQuantizedRangeImage(intrinsics, cloud);
+    ASSERT_TRUE(image.ok());
+    ASSERT_TRUE(doubleImage.ok());
+    ASSERT_TRUE(quantized.ok());
+
+    int32_t movedPixels = 0;
+    for (uint32_t col = 0; col < image->width(); ++col) {
+        movedPixels += ((*image)(0, col) == 0) != ((*doubleImage)(0, col) == 0);
+        EXPECT_EQ(quantized->code(0, col) == 0, (*image)(0, col) == 0) << col;
+        EXPECT_LE(std::abs(quantized->range(0, col) - (*image)(0, col)), quantized->maxRangeError() * (1 + 1e-6));
+    }
+
+    // The float and double projections must disagree for the comparison to tell which one was quantized
+    EXPECT_GT(movedPixels, 0);
+}
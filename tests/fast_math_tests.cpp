@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "math/FastMath.h"
+#include <Eigen/Core>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <random>
+
+namespace alice_lri {
+
+class FastMathTest : public ::testing::Test {
+protected:
+    static double ulpDistance(const double value, const double reference) {
+        if (value == reference || (std::isnan(value) && std::isnan(reference))) {
+            return 0;
+        }
+
+        const double ulp = std::nextafter(std::abs(reference), std::numeric_limits<double>::infinity()) -
+            std::abs(reference);
+        return std::abs(value - reference) / ulp;
+    }
+
+    std::mt19937_64 generator{42};
+    static constexpr Eigen::Index SAMPLES = 1 << 20;
+};
+
+TEST_F(FastMathTest, Atan2WithinUlpBound) {
+    std::uniform_real_distribution<double> distribution(-100, 100);
+    Eigen::ArrayXd y(SAMPLES), x(SAMPLES), result(SAMPLES);
+
+    for (Eigen::Index i = 0; i < SAMPLES; ++i) {
+        y(i) = distribution(generator) * (i % 4 == 1 ? 1e-9 : 1);
+        x(i) = distribution(generator) * (i % 4 == 2 ? 1e-9 : 1);
+    }
+    // Special values that must go through libm
+    y(0) = 0; x(0) = 0;
+    y(1) = -0.0; x(1) = -1;
+    y(2) = 1; x(2) = std::numeric_limits<double>::infinity();
+    y(3) = std::numeric_limits<double>::quiet_NaN();
+
+    FastMath::atan2(y, x, result);
+
+    for (Eigen::Index i = 0; i < SAMPLES; ++i) {
+        ASSERT_LE(ulpDistance(result(i), std::atan2(y(i), x(i))), FastMath::ATAN2_MAX_ULP) << y(i) << " " << x(i);
+    }
+    EXPECT_EQ(result(1), -std::numbers::pi);
+}
+
+TEST_F(FastMathTest, AsinWithinUlpBound) {
+    std::uniform_real_distribution<double> distribution(-1, 1);
+    // Odd size, so that the tail of the batch is exercised as well
+    Eigen::ArrayXd x(SAMPLES + 1), result(SAMPLES + 1);
+
+    for (Eigen::Index i = 0; i < x.size(); ++i) {
+        const double value = distribution(generator);
+        x(i) = i % 3 == 0 ? std::copysign(1 - std::abs(value) * 1e-6, value) : value;
+    }
+    x(0) = 1;
+    x(1) = -1;
+    x(2) = -0.0;
+    x(3) = 1.5;
+
+    FastMath::asin(x, result);
+
+    for (Eigen::Index i = 0; i < x.size(); ++i) {
+        ASSERT_LE(ulpDistance(result(i), std::asin(x(i))), FastMath::ASIN_MAX_ULP) << x(i);
+    }
+    EXPECT_TRUE(std::signbit(result(2)));
+}
+
+TEST_F(FastMathTest, OutputMayAliasInput) {
+    Eigen::ArrayXd values(5);
+    values << -1, -0.5, 0, 0.5, 1;
+    const Eigen::ArrayXd expected = values.asin();
+
+    FastMath::asin(values, values);
+
+    for (Eigen::Index i = 0; i < values.size(); ++i) {
+        EXPECT_LE(ulpDistance(values(i), expected(i)), FastMath::ASIN_MAX_ULP);
+    }
+}
+
+}
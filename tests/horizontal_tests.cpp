@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "intrinsics/horizontal/HorizontalIntrinsicsEstimator.h"
+#include "intrinsics/horizontal/helper/ResolutionCandidateGenerator.h"
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "Constants.h"
+
+namespace alice_lri {
+
+class HorizontalTest : public ::testing::Test {
+protected:
+    static Eigen::ArrayXd makeScanlineThetas(const int32_t resolution, const int32_t columnStride) {
+        constexpr double offset = 0.03;
+        constexpr double thetaOffset = 4e-4;
+        std::vector<double> thetas;
+
+        for (int32_t column = 0; column < resolution; column += columnStride) {
+            if ((column * 7) % 10 < 3) {
+                continue;
+            }
+
+            const double rangeXy = 8 + 4 * std::sin(column * 0.01);
+            double theta = column * Constant::TWO_PI / resolution + thetaOffset + offset / rangeXy;
+            theta -= theta > std::numbers::pi ? Constant::TWO_PI : 0;
+            thetas.emplace_back(theta);
+        }
+
+        return Eigen::Map<Eigen::ArrayXd>(thetas.data(), static_cast<Eigen::Index>(thetas.size()));
+    }
+
+    // Scanlines of the given resolutions, as a scanline array of points at varying xy ranges
+    static HorizontalScanlineArray makeScanlineArray(const std::vector<int32_t> &resolutions) {
+        constexpr double offset = 0.03;
+        constexpr double thetaOffset = 4e-4;
+        std::vector<double> x, y, z;
+        std::vector<int> scanlineIds;
+
+        for (int32_t scanlineIdx = 0; scanlineIdx < static_cast<int32_t>(resolutions.size()); ++scanlineIdx) {
+            const int32_t resolution = resolutions[scanlineIdx];
+
+            for (int32_t column = 0; column < resolution; ++column) {
+                if ((column * 7) % 10 < 3) {
+                    continue;
+                }
+
+                const double rangeXy = 8 + 4 * std::sin(column * 0.01);
+                const double theta = column * Constant::TWO_PI / resolution + thetaOffset + offset / rangeXy;
+                x.emplace_back(rangeXy * std::cos(theta));
+                y.emplace_back(rangeXy * std::sin(theta));
+                z.emplace_back(0.1 * scanlineIdx);
+                scanlineIds.emplace_back(scanlineIdx);
+            }
+        }
+
+        const auto size = static_cast<Eigen::Index>(x.size());
+        const PointArray points(
+            Eigen::Map<Eigen::ArrayXd>(x.data(), size), Eigen::Map<Eigen::ArrayXd>(y.data(), size),
+            Eigen::Map<Eigen::ArrayXd>(z.data(), size)
+        );
+        return {points, scanlineIds, static_cast<int32_t>(resolutions.size()), SortingCriteria::RANGES_XY};
+    }
+
+    static bool contains(const std::vector<int32_t> &values, const int32_t value) {
+        return std::ranges::find(values, value) != values.end();
+    }
+};
+
+TEST_F(HorizontalTest, CandidatesContainTrueResolution) {
+    const Eigen::ArrayXd thetas = makeScanlineThetas(2048, 1);
+    const auto candidates = ResolutionCandidateGenerator::generate(thetas, static_cast<int32_t>(thetas.size()));
+
+    ASSERT_TRUE(candidates.has_value());
+    EXPECT_TRUE(contains(*candidates, 2048));
+    EXPECT_LT(candidates->size(), 200);
+    EXPECT_TRUE(std::ranges::is_sorted(*candidates));
+}
+
+TEST_F(HorizontalTest, CandidatesContainTrueResolutionForSparseScanline) {
+    const Eigen::ArrayXd thetas = makeScanlineThetas(4000, 3);
+    const auto candidates = ResolutionCandidateGenerator::generate(thetas, static_cast<int32_t>(thetas.size()));
+
+    ASSERT_TRUE(candidates.has_value());
+    EXPECT_TRUE(contains(*candidates, 4000));
+}
+
+TEST_F(HorizontalTest, NoCandidatesForTooFewPoints) {
+    Eigen::ArrayXd thetas(4);
+    thetas << 0.1, 0.2, 0.3, 0.4;
+
+    EXPECT_FALSE(ResolutionCandidateGenerator::generate(thetas, 4).has_value());
+}
+
+TEST_F(HorizontalTest, HintsAcceptedForMatchingScanlines) {
+    const HorizontalScanlineArray scanlineArray = makeScanlineArray({1024, 4096});
+
+    const auto coarse = HorizontalIntrinsicsEstimator::tryResolutionHint(scanlineArray, 0, 1024);
+    ASSERT_TRUE(coarse.has_value());
+    EXPECT_EQ(coarse->resolution, 1024);
+
+    const auto fine = HorizontalIntrinsicsEstimator::tryResolutionHint(scanlineArray, 1, 4096);
+    ASSERT_TRUE(fine.has_value());
+    EXPECT_EQ(fine->resolution, 4096);
+    EXPECT_NEAR(fine->offset, 0.03, 1e-6);
+}
+
+TEST_F(HorizontalTest, WrongHintsAreRejected) {
+    const HorizontalScanlineArray scanlineArray = makeScanlineArray({1024, 4096});
+
+    // Multiples of the true resolution fit the points as well as it does, so they are caught by their divisors
+    for (const int32_t hint : {2048, 3072, 4096}) {
+        EXPECT_FALSE(HorizontalIntrinsicsEstimator::tryResolutionHint(scanlineArray, 0, hint).has_value()) << hint;
+    }
+
+    // Resolutions that do not divide the hint cannot fit the points
+    for (const int32_t hint : {1000, 1030, 2000}) {
+        EXPECT_FALSE(HorizontalIntrinsicsEstimator::tryResolutionHint(scanlineArray, 0, hint).has_value()) << hint;
+    }
+
+    // A coarser hint than the scanline holds points is never tried
+    EXPECT_FALSE(HorizontalIntrinsicsEstimator::tryResolutionHint(scanlineArray, 1, 1024).has_value());
+}
+
+TEST_F(HorizontalTest, RacingMatchesExhaustiveEvaluation) {
+    const HorizontalScanlineArray scanlineArray = makeScanlineArray({4096});
+
+    std::vector<int32_t> resolutions;
+    for (int32_t resolution = scanlineArray.getSize(0); resolution < 6000; resolution += 13) {
+        resolutions.emplace_back(resolution);
+    }
+    resolutions.emplace_back(4096);
+    std::ranges::sort(resolutions);
+
+    const auto raced = HorizontalIntrinsicsEstimator::findBestCandidateResolution(scanlineArray, 0, resolutions, true);
+    const auto exhaustive = HorizontalIntrinsicsEstimator::findBestCandidateResolution(
+        scanlineArray, 0, resolutions, false
+    );
+
+    ASSERT_TRUE(raced.has_value());
+    ASSERT_TRUE(exhaustive.has_value());
+    EXPECT_EQ(exhaustive->resolution, 4096);
+    EXPECT_EQ(raced->resolution, exhaustive->resolution);
+    EXPECT_DOUBLE_EQ(raced->offset, exhaustive->offset);
+    EXPECT_DOUBLE_EQ(raced->thetaOffset, exhaustive->thetaOffset);
+    EXPECT_DOUBLE_EQ(raced->loss, exhaustive->loss);
+}
+
+}
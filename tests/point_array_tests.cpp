@@ -1,7 +1,12 @@
 #include <gtest/gtest.h>
 #include "point/PointArray.h"
+#include "point/PointSubsampler.h"
+#include "point/PointUtils.h"
 #include <Eigen/Core>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <random>
 
 namespace alice_lri {
 
@@ -67,6 +72,78 @@ TEST_F(PointArrayTest, IndexAccess) {
     EXPECT_NEAR(selectedX(1), expectedX(1), 1e-10);
 }
 
+TEST_F(PointArrayTest, SelectKeepsCoordsEps) {
+    PointArray points(x, y, z);
+
+    Eigen::ArrayXi indices(2);
+    indices << 0, 2;
+
+    const PointArray selected = points.select(indices);
+    EXPECT_EQ(selected.size(), 2);
+    EXPECT_EQ(selected.getX(1), 3.0);
+    EXPECT_NEAR(selected.getRange(1), points.getRange(2), 1e-10);
+    EXPECT_NEAR(selected.getPhi(0), points.getPhi(0), 1e-10);
+    EXPECT_EQ(selected.getMinRange(), points.getRange(0));
+    EXPECT_EQ(selected.getCoordsEps(), points.getCoordsEps());
+}
+
+TEST_F(PointArrayTest, ReleasedFieldsAreRecomputed) {
+    PointArray points(x, y, z);
+    const Eigen::ArrayXd thetas = points.getThetas();
+    const Eigen::ArrayXd invRangesXy = points.getInvRangesXy();
+
+    points.releaseHorizontalFields();
+
+    EXPECT_TRUE((points.getThetas() == thetas).all());
+    EXPECT_TRUE((points.getInvRangesXy() == invRangesXy).all());
+    EXPECT_EQ(points.getRangeXy(1), std::sqrt(x(1) * x(1) + y(1) * y(1)));
+}
+
+TEST_F(PointArrayTest, StratifiedSubsample) {
+    constexpr int32_t count = 1000;
+    const Eigen::ArrayXd angles = Eigen::ArrayXd::LinSpaced(count, 0, 6);
+    const Eigen::ArrayXd ranges = Eigen::ArrayXd::LinSpaced(count, 2, 50);
+    PointArray points(ranges * angles.cos(), ranges * angles.sin(), Eigen::ArrayXd::LinSpaced(count, -1, 1));
+
+    EXPECT_FALSE(PointSubsampler::shouldSubsample(points, 0));
+    EXPECT_FALSE(PointSubsampler::shouldSubsample(points, count));
+    EXPECT_TRUE(PointSubsampler::shouldSubsample(points, 100));
+
+    const Eigen::ArrayXi indices = PointSubsampler::stratifiedIndices(points, 100);
+    EXPECT_EQ(indices.size(), 100);
+
+    for (Eigen::Index i = 1; i < indices.size(); ++i) {
+        EXPECT_LT(indices[i - 1], indices[i]);
+    }
+
+    EXPECT_TRUE((indices == PointSubsampler::stratifiedIndices(points, 100)).all());
+}
+
+TEST_F(PointArrayTest, CoordsEpsIsHalfTheQuantizationStep) {
+    std::mt19937_64 generator(7);
+    std::uniform_int_distribution<int32_t> steps(-40000, 40000);
+    constexpr double step = 0.005;
+    Eigen::ArrayXd qx(5000), qy(5000), qz(5000);
+
+    for (Eigen::Index i = 0; i < qx.size(); ++i) {
+        qx(i) = steps(generator) * step;
+        qy(i) = steps(generator) * step;
+        qz(i) = steps(generator) * step / 8 + 0.25;
+    }
+    qx(0) = -0.0;
+    qx(1) = 0.0;
+
+    Eigen::ArrayXd sortedZ = qz;
+    std::ranges::sort(sortedZ);
+    double expectedGap = std::numeric_limits<double>::infinity();
+    for (Eigen::Index i = 1; i < sortedZ.size(); ++i) {
+        const double gap = sortedZ(i) - sortedZ(i - 1);
+        expectedGap = gap > 0 ? std::min(expectedGap, gap) : expectedGap;
+    }
+
+    EXPECT_EQ(PointUtils::computeCoordsEps(PointArray(qx, qy, qz)), expectedGap / 2);
+}
+
 // Add more tests for PointArray functionality
 
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "alice_lri/Core.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace alice_lri {
+
+class PointCloudReaderTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (const auto &path: paths) {
+            std::filesystem::remove(path);
+        }
+    }
+
+    std::string writeFile(const std::string &name, const std::string &header, const std::vector<char> &data) {
+        const auto path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream file(path, std::ios::binary);
+        file << header;
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        paths.emplace_back(path);
+        return path;
+    }
+
+    template<typename T>
+    static void append(std::vector<char> &data, const T value) {
+        const auto offset = data.size();
+        data.resize(offset + sizeof(T));
+        std::memcpy(data.data() + offset, &value, sizeof(T));
+    }
+
+    template<typename Cloud>
+    static void expectPoints(const Cloud &cloud, const std::vector<std::array<float, 3>> &expected) {
+        ASSERT_EQ(cloud.x.size(), expected.size());
+        for (uint64_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(cloud.x[i], expected[i][0]);
+            EXPECT_EQ(cloud.y[i], expected[i][1]);
+            EXPECT_EQ(cloud.z[i], expected[i][2]);
+        }
+    }
+
+    std::vector<std::string> paths;
+};
+
+TEST_F(PointCloudReaderTest, ReadsKittiAndSkipsZeroPoints) {
+    std::vector<char> data;
+    for (const float value: {1.0f, 2.0f, 3.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, -4.0f, 0.1f}) {
+        append(data, value);
+    }
+    const auto path = writeFile("alice_lri_reader_test.bin", "", data);
+
+    const auto mapped = mapPointCloudFile(path.c_str());
+    ASSERT_TRUE(mapped.ok());
+    EXPECT_EQ(mapped->size(), 3);
+    EXPECT_EQ(mapped->view().stride, 4 * sizeof(float));
+
+    const auto cloud = readPointCloudFile(path.c_str());
+    ASSERT_TRUE(cloud.ok());
+    expectPoints(*cloud, {{1, 2, 3}, {0, 0, -4}});
+
+    // The double reader widens the same coordinates, so both clouds hold the same points
+    const auto doubleCloud = readPointCloudFileDouble(path.c_str());
+    ASSERT_TRUE(doubleCloud.ok());
+    expectPoints(*doubleCloud, {{1, 2, 3}, {0, 0, -4}});
+}
+
+TEST_F(PointCloudReaderTest, ReadsBinaryPcdWithUnalignedHeader) {
+    // The header length is not a multiple of four, so the records are copied to an aligned buffer
+    const std::string header = "# .PCD v0.7\nVERSION 0.7\nFIELDS intensity x y z\nSIZE 4 4 4 4\nTYPE F F F F\n"
+        "COUNT 1 1 1 1\nWIDTH 2\nHEIGHT 1\nPOINTS 2\nDATA binary\n";
+    ASSERT_NE(header.size() % sizeof(float), 0);
+
+    std::vector<char> data;
+    for (const float value: {9.0f, 1.0f, 2.0f, 3.0f, 9.0f, 4.0f, 5.0f, 6.0f}) {
+        append(data, value);
+    }
+    const auto path = writeFile("alice_lri_reader_test.pcd", header, data);
+
+    const auto cloud = readPointCloudFile(path.c_str());
+    ASSERT_TRUE(cloud.ok());
+    expectPoints(*cloud, {{1, 2, 3}, {4, 5, 6}});
+}
+
+TEST_F(PointCloudReaderTest, ReadsBinaryPlyWithMixedFields) {
+    const std::string header = "ply\nformat binary_little_endian 1.0\nelement vertex 2\nproperty float x\n"
+        "property float y\nproperty float z\nproperty uchar ring\nelement face 0\n"
+        "property list uchar int vertex_indices\nend_header\n";
+
+    std::vector<char> data;
+    for (const float offset: {0.0f, 10.0f}) {
+        append(data, offset + 1);
+        append(data, offset + 2);
+        append(data, offset + 3);
+        append(data, static_cast<uint8_t>(offset));
+    }
+    const auto path = writeFile("alice_lri_reader_test.ply", header, data);
+
+    const auto mapped = mapPointCloudFile(path.c_str());
+    ASSERT_TRUE(mapped.ok());
+    EXPECT_EQ(mapped->size(), 2);
+
+    const auto cloud = readPointCloudFile(path.c_str());
+    ASSERT_TRUE(cloud.ok());
+    expectPoints(*cloud, {{1, 2, 3}, {11, 12, 13}});
+}
+
+TEST_F(PointCloudReaderTest, RejectsUnsupportedFiles) {
+    const auto ascii = writeFile("alice_lri_reader_ascii.pcd",
+        "FIELDS x y z\nSIZE 4 4 4\nTYPE F F F\nCOUNT 1 1 1\nPOINTS 1\nDATA ascii\n", {'1', ' ', '2', ' ', '3'});
+    EXPECT_EQ(readPointCloudFile(ascii.c_str()).status().code, ErrorCode::INVALID_FILE_FORMAT);
+
+    // A field count whose size wraps the record stride around to fewer bytes than the coordinates it holds
+    const auto overflowing = writeFile("alice_lri_reader_overflowing.pcd",
+        "FIELDS x y z i\nSIZE 4 4 4 4\nTYPE F F F F\nCOUNT 1 1 1 4611686018427387902\nPOINTS 2\nDATA binary\n",
+        std::vector<char>(8, 0));
+    EXPECT_EQ(readPointCloudFile(overflowing.c_str()).status().code, ErrorCode::INVALID_FILE_FORMAT);
+    EXPECT_EQ(mapPointCloudFile(overflowing.c_str()).status().code, ErrorCode::INVALID_FILE_FORMAT);
+
+    const auto truncated = writeFile("alice_lri_reader_truncated.bin", "", {0, 0, 0});
+    EXPECT_EQ(readPointCloudFile(truncated.c_str()).status().code, ErrorCode::INVALID_FILE_FORMAT);
+
+    EXPECT_EQ(readPointCloudFile("alice_lri_missing.bin").status().code, ErrorCode::FILE_ERROR);
+}
+
+}
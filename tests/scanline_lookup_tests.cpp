@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "rangeimage/ScanlineLookup.h"
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace alice_lri {
+
+class ScanlineLookupTest : public ::testing::Test {
+protected:
+    // Reference full scan, with the first scanline winning ties
+    static int32_t fullScan(const std::vector<Scanline> &scanlines, const double range, const double phi,
+                            double &phiDiffMargin) {
+        double minPhiDiff = std::numeric_limits<double>::max();
+        double secondPhiDiff = std::numeric_limits<double>::max();
+        int32_t best = -1;
+
+        for (int32_t i = 0; i < static_cast<int32_t>(scanlines.size()); ++i) {
+            const double phiDiff = std::abs(phi - scanlines[i].verticalOffset / range - scanlines[i].verticalAngle);
+            if (phiDiff < minPhiDiff) {
+                secondPhiDiff = minPhiDiff;
+                minPhiDiff = phiDiff;
+                best = i;
+            } else if (phiDiff < secondPhiDiff) {
+                secondPhiDiff = phiDiff;
+            }
+        }
+
+        phiDiffMargin = secondPhiDiff - minPhiDiff;
+        return best;
+    }
+
+    static std::vector<Scanline> makeScanlines(std::mt19937_64 &generator, const int32_t count) {
+        std::uniform_real_distribution<double> offsets(-0.15, 0.15);
+        std::vector<Scanline> scanlines;
+
+        for (int32_t i = 0; i < count; ++i) {
+            const double angle = -0.4 + 0.5 * i / count;
+            scanlines.emplace_back(Scanline{
+                .verticalOffset = offsets(generator), .verticalAngle = angle, .horizontalOffset = 0,
+                .azimuthalOffset = 0, .resolution = 1024
+            });
+        }
+        // Duplicated scanlines tie everywhere, so the lowest index must win
+        scanlines[count / 2] = scanlines[count / 2 + 1];
+
+        return scanlines;
+    }
+
+    std::mt19937_64 generator{7};
+};
+
+TEST_F(ScanlineLookupTest, MatchesFullScan) {
+    for (const int32_t count: {3, 16, 64, 128}) {
+        const std::vector<Scanline> scanlines = makeScanlines(generator, count);
+        constexpr double minRange = 1.5;
+        const ScanlineLookup lookup(scanlines, minRange, 1 << 14);
+
+        std::uniform_real_distribution<double> ranges(minRange, 120);
+        std::uniform_real_distribution<double> phis(-0.6, 0.3);
+        std::uniform_int_distribution<int32_t> picks(0, count - 1);
+
+        for (int32_t i = 0; i < 200000; ++i) {
+            const double range = i % 3 == 0 ? minRange : ranges(generator);
+            // Points exactly on a scanline, or halfway between two, stress the ties and the margin
+            const Scanline &scanline = scanlines[picks(generator)];
+            const double onScanline = scanline.verticalAngle + scanline.verticalOffset / range;
+            const double phi = i % 5 == 0 ? onScanline : i % 5 == 1 ? onScanline + 0.5 * 0.5 / count : phis(generator);
+
+            double expectedMargin, margin;
+            const int32_t expected = fullScan(scanlines, range, phi, expectedMargin);
+            ASSERT_EQ(lookup.findBestScanline(range, phi, margin), expected) << range << " " << phi;
+            ASSERT_EQ(margin, expectedMargin) << range << " " << phi;
+        }
+    }
+}
+
+TEST_F(ScanlineLookupTest, PointsOutsideGridAreFullyScanned) {
+    const std::vector<Scanline> scanlines = makeScanlines(generator, 32);
+    const ScanlineLookup lookup(scanlines, 2, 1 << 10);
+
+    for (const auto &[range, phi]: std::vector<std::pair<double, double>>{{0.5, 0}, {10, 3}, {10, -3}, {1e-3, 0.1}}) {
+        double expectedMargin, margin;
+        EXPECT_EQ(lookup.findBestScanline(range, phi, margin), fullScan(scanlines, range, phi, expectedMargin));
+        EXPECT_EQ(margin, expectedMargin);
+    }
+}
+
+}
@@ -67,4 +67,22 @@ TEST_F(StatsTest, WeightedBoundsRegression) {
 }
 
 
+TEST_F(StatsTest, WeightedMedianMatchesSortedCumulativeWeight) {
+    std::vector<double> values = {5.0, 1.0, 3.0, 3.0, 9.0, 7.0, 3.0, 2.0};
+    std::vector<int32_t> weights = {1, 4, 1, 2, 3, 1, 1, 2};
+
+    // Sorted: 1(4) 2(2) 3(1) 3(2) 3(1) 5(1) 7(1) 9(3); total 15, cumulative weight reaches 7.5 at value 3
+    EXPECT_DOUBLE_EQ(Stats::weightedMedian(values, weights), 3.0);
+
+    std::vector<double> single = {4.0};
+    std::vector<int32_t> singleWeight = {7};
+    EXPECT_DOUBLE_EQ(Stats::weightedMedian(single, singleWeight), 4.0);
+
+    // Exactly half the weight at the lower value returns the lower value
+    std::vector<double> halves = {8.0, 2.0};
+    std::vector<int32_t> halvesWeights = {3, 3};
+    EXPECT_DOUBLE_EQ(Stats::weightedMedian(halves, halvesWeights), 2.0);
+}
+
+
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include "utils/Parallel.h"
 #include "utils/Utils.h"
 #include <Eigen/Core>
+#include <algorithm>
 #include <vector>
 
 namespace alice_lri {
@@ -50,4 +52,22 @@ namespace alice_lri {
         EXPECT_EQ(indices.size(), expectedIndices.size());
         EXPECT_TRUE(indices.isApprox(expectedIndices));
     }
+
+    TEST_F(UtilsTest, ParallelForVisitsEachIndexOnce) {
+        std::vector<int> visits(1000, 0);
+        std::vector<int> nestedVisits(100, 0);
+
+        Parallel::parallelFor(0, 1000, [&](const int64_t i) {
+            visits[i]++;
+        }, 7);
+
+        Parallel::parallelFor(0, 10, [&](const int64_t i) {
+            Parallel::parallelFor(0, 10, [&](const int64_t j) {
+                nestedVisits[i * 10 + j]++;
+            });
+        });
+
+        EXPECT_TRUE(std::ranges::all_of(visits, [](const int v) { return v == 1; }));
+        EXPECT_TRUE(std::ranges::all_of(nestedVisits, [](const int v) { return v == 1; }));
+    }
 }
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include "intrinsics/vertical/VerticalIntrinsicsEstimator.h"
+#include "intrinsics/vertical/estimation/VerticalScanlineAssigner.h"
+#include "point/PointArray.h"
+#include "point/PointSubsampler.h"
+#include <Eigen/Core>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace alice_lri {
+
+class VerticalTest : public ::testing::Test {
+protected:
+    // Scanlines evenly spread in vertical angle, with an offset and ranges varying along each of them,
+    // and coordinates rounded to millimetres as a sensor would store them
+    static PointArray makeScanlinesCloud(const int32_t scanlinesCount, const int32_t pointsPerScanline) {
+        constexpr double offset = 0.05;
+        std::vector<double> x, y, z;
+
+        for (int32_t scanlineIdx = 0; scanlineIdx < scanlinesCount; ++scanlineIdx) {
+            const double angle = -0.3 + 0.025 * scanlineIdx;
+
+            for (int32_t column = 0; column < pointsPerScanline; ++column) {
+                const double theta = -std::numbers::pi + 2 * std::numbers::pi * column / pointsPerScanline;
+                const double range = 12 + 8 * std::sin(column * 0.013 + scanlineIdx);
+                const double phi = angle + std::asin(offset / range);
+                x.emplace_back(std::round(range * std::cos(phi) * std::cos(theta) * 1000) / 1000);
+                y.emplace_back(std::round(range * std::cos(phi) * std::sin(theta) * 1000) / 1000);
+                z.emplace_back(std::round(range * std::sin(phi) * 1000) / 1000);
+            }
+        }
+
+        const auto size = static_cast<Eigen::Index>(x.size());
+        return {
+            Eigen::Map<Eigen::ArrayXd>(x.data(), size), Eigen::Map<Eigen::ArrayXd>(y.data(), size),
+            Eigen::Map<Eigen::ArrayXd>(z.data(), size)
+        };
+    }
+};
+
+TEST_F(VerticalTest, SubsampledEstimateAssignsPointsLikeFullEstimate) {
+    const PointArray points = makeScanlinesCloud(16, 1000);
+    const VerticalIntrinsicsEstimation full = VerticalIntrinsicsEstimator::estimate(points);
+
+    const PointArray subsample = points.select(PointSubsampler::stratifiedIndices(points, 4000));
+    VerticalIntrinsicsEstimation subsampled = VerticalIntrinsicsEstimator::estimate(subsample);
+    VerticalScanlineAssigner::assignAllPoints(points, subsampled);
+
+    ASSERT_EQ(full.scanlinesAssignations.scanlines.size(), 16);
+    ASSERT_EQ(subsampled.scanlinesAssignations.scanlines.size(), 16);
+    EXPECT_EQ(subsampled.pointsCount, full.pointsCount);
+    EXPECT_EQ(subsampled.unassignedPoints, full.unassignedPoints);
+    EXPECT_EQ(subsampled.scanlinesAssignations.pointsScanlinesIds, full.scanlinesAssignations.pointsScanlinesIds);
+
+    for (size_t i = 0; i < full.scanlinesAssignations.scanlines.size(); ++i) {
+        EXPECT_EQ(
+            subsampled.scanlinesAssignations.scanlines[i].pointsCount, full.scanlinesAssignations.scanlines[i].pointsCount
+        ) << i;
+    }
+}
+
+}